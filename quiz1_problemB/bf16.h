@@ -0,0 +1,756 @@
+#ifndef BF16_H
+#define BF16_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* ============= BFloat16 Implementation ============= */
+
+typedef struct {
+    uint16_t bits;
+} bf16_t;
+
+#define BF16_EXP_BIAS 127
+#define BF16_SIGN_MASK 0x8000U
+#define BF16_EXP_MASK 0x7F80U
+#define BF16_MANT_MASK 0x007FU
+
+#define BF16_NAN() ((bf16_t) {.bits = 0x7FC0})
+#define BF16_ZERO() ((bf16_t) {.bits = 0x0000})
+
+static const bf16_t bf16_one = {.bits = 0x3F80};
+static const bf16_t bf16_two = {.bits = 0x4000};
+
+static inline bool bf16_isnan(bf16_t a)
+{
+    return ((a.bits & BF16_EXP_MASK) == BF16_EXP_MASK) &&
+           (a.bits & BF16_MANT_MASK);
+}
+
+static inline bool bf16_isinf(bf16_t a)
+{
+    return ((a.bits & BF16_EXP_MASK) == BF16_EXP_MASK) &&
+           !(a.bits & BF16_MANT_MASK);
+}
+
+static inline bool bf16_iszero(bf16_t a)
+{
+    return !(a.bits & 0x7FFF);
+}
+
+/* Monotonic key: a < b implies bf16_key(a) < bf16_key(b).  Negative
+ * values count down from 0x7FFF, +0 and -0 both become 0x8000, positive
+ * values count up; a NaN lands beyond the infinity of its sign.  Computed
+ * without branches, the scalar form of bf16x2_key().
+ */
+static inline uint16_t bf16_key(bf16_t a)
+{
+    uint32_t mag = a.bits & 0x7FFF;
+    uint32_t neg = (a.bits >> 15) & ((mag + 0x7FFF) >> 15);
+
+    return (mag | 0x8000) ^ (-neg & 0xFFFF);
+}
+
+/* Ordered comparisons: false if either operand is NaN, -0 == +0 */
+static inline bool bf16_eq(bf16_t a, bf16_t b)
+{
+    if (bf16_isnan(a) || bf16_isnan(b))
+        return false;
+    return bf16_key(a) == bf16_key(b);
+}
+
+static inline bool bf16_lt(bf16_t a, bf16_t b)
+{
+    if (bf16_isnan(a) || bf16_isnan(b))
+        return false;
+    return bf16_key(a) < bf16_key(b);
+}
+
+static inline bool bf16_le(bf16_t a, bf16_t b)
+{
+    return bf16_lt(a, b) || bf16_eq(a, b);
+}
+
+/* The smaller / larger operand.  A NaN operand is ignored (NaN only if
+ * both are), and for -0 and +0 a is returned.
+ */
+static inline bf16_t bf16_min(bf16_t a, bf16_t b)
+{
+    if (bf16_isnan(b))
+        return a;
+    if (bf16_isnan(a))
+        return b;
+    return bf16_key(b) < bf16_key(a) ? b : a;
+}
+
+static inline bf16_t bf16_max(bf16_t a, bf16_t b)
+{
+    if (bf16_isnan(b))
+        return a;
+    if (bf16_isnan(a))
+        return b;
+    return bf16_key(b) > bf16_key(a) ? b : a;
+}
+
+/* Count leading zeros by binary search without branches: each step
+ * shifts x left by 16, 8, 4, 2 or 1 when that many top bits are zero.
+ */
+static inline unsigned clz(uint32_t x)
+{
+    unsigned n = 0, s;
+
+    s = !(x >> 16) << 4;
+    n += s;
+    x <<= s;
+    s = !(x >> 24) << 3;
+    n += s;
+    x <<= s;
+    s = !(x >> 28) << 2;
+    n += s;
+    x <<= s;
+    s = !(x >> 30) << 1;
+    n += s;
+    x <<= s;
+    s = !(x >> 31);
+    n += s;
+    x <<= s;
+    return n + !x;
+}
+
+/* Significand with the hidden bit, denormals normalized (*exp adjusted).
+ * a must be finite and non-zero.
+ */
+static inline uint32_t bf16_unpack_mant(bf16_t a, int32_t *exp)
+{
+    uint32_t mant = a.bits & 0x7F;
+
+    *exp = (a.bits >> 7) & 0xFF;
+    if (*exp)
+        return mant | 0x80;
+
+    uint32_t sh = clz(mant) - 24;
+    *exp = 1 - sh;
+    return mant << sh;
+}
+
+/* Round sig * 2^(exp - 157) to bf16, to nearest with ties to even.  sig
+ * has its leading one in bit 30: bits 23..30 are the 8 significant bits,
+ * bit 22 the guard bit and bits 0..21 the sticky part.  exp is the biased
+ * exponent with no range limit.  Overflow gives infinity.  Below the
+ * normal range sig is first shifted into denormal position, the bits
+ * shifted out kept as a sticky bit, so an underflow is rounded only once.
+ * A carry out of the significand runs into the exponent field, which also
+ * takes the largest denormal up to the smallest normal and the largest
+ * finite value up to infinity.
+ */
+static inline bf16_t bf16_round_pack(uint32_t sign, int32_t exp, uint32_t sig)
+{
+    uint16_t s = sign << 15;
+
+    if (exp >= 0xFF)
+        return (bf16_t) {.bits = s | 0x7F80};
+    if (exp <= 0) {
+        uint32_t sh = 1 - exp;
+        sig = sh < 32 ? (sig >> sh) | ((sig << (32 - sh)) != 0) : 1;
+        exp = 1;
+    }
+    sig += 0x3FFFFF + ((sig >> 23) & 1);
+    return (bf16_t) {.bits = s | (((exp - 1) << 7) + (sig >> 23))};
+}
+
+/* a + b for finite non-zero operands, given as sign, biased exponent and
+ * 8-bit significand; a denormal comes in as exponent 1 without the hidden
+ * bit.  One shift aligns the smaller operand and one shift by clz
+ * normalizes the sum, so the step count does not depend on the values.
+ */
+static inline bf16_t bf16_add_unpacked(uint32_t sign_a,
+                                       int32_t exp_a,
+                                       uint32_t mant_a,
+                                       uint32_t sign_b,
+                                       int32_t exp_b,
+                                       uint32_t mant_b)
+{
+    if (exp_a < exp_b) {
+        uint32_t t = sign_a;
+        sign_a = sign_b;
+        sign_b = t;
+        t = exp_a;
+        exp_a = exp_b;
+        exp_b = t;
+        t = mant_a;
+        mant_a = mant_b;
+        mant_b = t;
+    }
+
+    /* b is below half an ulp of a, even when a is a power of two and the
+     * ulp below it is half as large: a is the rounded result
+     */
+    uint32_t exp_diff = exp_a - exp_b;
+    if (exp_diff > 9)
+        return (bf16_t) {.bits = sign_a << 15 | (((exp_a - 1) << 7) + mant_a)};
+
+    /* both fit with 14 zero bits to spare, so the alignment is exact */
+    uint32_t sig_a = mant_a << 23, sig_b = (mant_b << 23) >> exp_diff;
+    uint32_t result_mant;
+
+    if (sign_a == sign_b)
+        result_mant = sig_a + sig_b;
+    else if (sig_a >= sig_b)
+        result_mant = sig_a - sig_b;
+    else {
+        result_mant = sig_b - sig_a;
+        sign_a = sign_b;
+    }
+    if (!result_mant)
+        return BF16_ZERO();
+
+    uint32_t lz = clz(result_mant);
+    return bf16_round_pack(sign_a, exp_a + 1 - lz, (result_mant << lz) >> 1);
+}
+
+static inline bf16_t bf16_add(bf16_t a, bf16_t b)
+{
+    uint16_t sign_a = a.bits >> 15 & 0x1, sign_b = b.bits >> 15 & 1;
+    int16_t exp_a = a.bits >> 7 & 0xFF, exp_b = b.bits >> 7 & 0xFF;
+    uint16_t mant_a = a.bits & 0x7F, mant_b = b.bits & 0x7F;
+
+    /* Infinity and NaN */
+    if (exp_a == 0xFF) {
+        if (mant_a)
+            return a;
+        if (exp_b == 0xFF)
+            return (mant_b || sign_a == sign_b) ? b : BF16_NAN();
+        return a;
+    }
+
+    /* if a is normal/denormal, but b is infinity/NaN */
+    if (exp_b == 0xFF)
+        return b;
+
+    /* if a == 0, b == 0; the sum of two zeros is -0 only if both are */
+    if (!exp_a && !mant_a) {
+        if (!exp_b && !mant_b)
+            return (bf16_t) {.bits = a.bits & b.bits};
+        return b;
+    }
+    if (!exp_b && !mant_b)
+        return a;
+
+    /* if a, b is normal; a denormal keeps exponent 1 */
+    if (exp_a)
+        mant_a |= 0x80;
+    else
+        exp_a = 1;
+    if (exp_b)
+        mant_b |= 0x80;
+    else
+        exp_b = 1;
+
+    return bf16_add_unpacked(sign_a, exp_a, mant_a, sign_b, exp_b, mant_b);
+}
+
+static inline bf16_t bf16_sub(bf16_t a, bf16_t b)
+{
+    b.bits ^= 0x8000U;
+    return bf16_add(a, b);
+}
+
+/* Product of two 8-bit mantissas with the hidden bit set (0x80..0xFF).
+ * RV32I has no multiplier, so a plain '*' becomes a call to the shift-add
+ * __mulsi3.  BF16_MUL_TABLE trades table size for speed:
+ *   0  shift-add __mulsi3, no table
+ *   1  16 x 16 nibble products (256 B), four lookups
+ *   2  128 x 16 mantissa-by-nibble products (4 KiB), two lookups
+ *   3  full 128 x 128 products (32 KiB), one lookup
+ * Options 1 and 2 use (0x80 + a)(0x80 + b) = 0x4000 + ((a + b) << 7) + a * b
+ * and only look up the 7-bit by 7-bit part.
+ */
+#ifndef BF16_MUL_TABLE
+#define BF16_MUL_TABLE 2
+#endif
+
+extern const uint8_t bf16_nib_mul_table[16][16];
+extern const uint16_t bf16_mant_nib_table[128][16];
+extern const uint16_t bf16_mant_mul_table[128][128];
+
+static inline uint32_t bf16_mant_mul(uint32_t mant_a, uint32_t mant_b)
+{
+#if BF16_MUL_TABLE == 3
+    return bf16_mant_mul_table[mant_a & 0x7F][mant_b & 0x7F];
+#elif BF16_MUL_TABLE == 2
+    uint32_t a = mant_a & 0x7F, b = mant_b & 0x7F;
+    return 0x4000 + ((a + b) << 7) + bf16_mant_nib_table[a][b & 0xF] +
+           (bf16_mant_nib_table[a][b >> 4] << 4);
+#elif BF16_MUL_TABLE == 1
+    uint32_t a = mant_a & 0x7F, b = mant_b & 0x7F;
+    uint32_t al = a & 0xF, ah = a >> 4, bl = b & 0xF, bh = b >> 4;
+    return 0x4000 + ((a + b) << 7) + bf16_nib_mul_table[al][bl] +
+           ((bf16_nib_mul_table[ah][bl] + bf16_nib_mul_table[al][bh]) << 4) +
+           (bf16_nib_mul_table[ah][bh] << 8);
+#else
+    return mant_a * mant_b;
+#endif
+}
+
+/* Product of two significands with the hidden bit set, denormals
+ * normalized; exp is the biased exponent of the product.
+ */
+static inline bf16_t bf16_mul_unpacked(uint32_t sign,
+                                       int32_t exp,
+                                       uint32_t mant_a,
+                                       uint32_t mant_b)
+{
+    uint32_t result_mant = bf16_mant_mul(mant_a, mant_b);
+
+    /* the product is in [2^14, 2^16): one shift puts the top bit at 30 */
+    uint32_t carry = result_mant >> 15;
+    return bf16_round_pack(sign, exp + carry, result_mant << (16 - carry));
+}
+
+static inline bf16_t bf16_mul(bf16_t a, bf16_t b)
+{
+    uint16_t sign_a = (a.bits >> 15) & 1;
+    uint16_t sign_b = (b.bits >> 15) & 1;
+    int32_t exp_a = ((a.bits >> 7) & 0xFF);
+    int32_t exp_b = ((b.bits >> 7) & 0xFF);
+    uint32_t mant_a = a.bits & 0x7F;
+    uint32_t mant_b = b.bits & 0x7F;
+
+    uint16_t result_sign = sign_a ^ sign_b;
+
+    if (exp_a == 0xFF && mant_a)
+        return a;
+    if (exp_b == 0xFF && mant_b)
+        return b;
+    if (exp_a == 0xFF || exp_b == 0xFF) {
+        if ((!exp_a && !mant_a) || (!exp_b && !mant_b))
+            return BF16_NAN();
+        return (bf16_t) {.bits = (result_sign << 15) | 0x7F80};
+    }
+    if ((!exp_a && !mant_a) || (!exp_b && !mant_b))
+        return (bf16_t) {.bits = result_sign << 15};
+
+    /* denormals normalized with one shift, exponents adjusted */
+    mant_a = bf16_unpack_mant(a, &exp_a);
+    mant_b = bf16_unpack_mant(b, &exp_b);
+
+    return bf16_mul_unpacked(result_sign, exp_a + exp_b - BF16_EXP_BIAS,
+                             mant_a, mant_b);
+}
+
+/* Reciprocals of the 8-bit divisor mantissas, ceil(2^24 / (0x80 | m)).
+ * For a dividend mantissa A and divisor mantissa B in [128, 255],
+ * (A * R) >> 16 == floor(A * 256 / B) exactly: the rounding error of R is
+ * below 1, and A * B < 2^16 keeps it under the 1/B gap to the next integer.
+ */
+extern const uint32_t bf16_recip_table[128];
+
+/* Quotient of two significands with the hidden bit set, denormals
+ * normalized; exp is the biased exponent of the quotient when
+ * mant_a >= mant_b.  One multiply by the reciprocal gives the 9-bit
+ * quotient floor(mant_a * 256 / mant_b); the remainder supplies the one
+ * extra bit needed when mant_a < mant_b, and the sticky bit.
+ */
+static inline bf16_t bf16_div_unpacked(uint32_t sign,
+                                       int32_t exp,
+                                       uint32_t mant_a,
+                                       uint32_t mant_b)
+{
+    /* 8-bit factor second: __mulsi3 iterates over its second operand */
+    uint32_t quotient = (bf16_recip_table[mant_b & 0x7F] * mant_a) >> 16;
+    uint32_t rem = (mant_a << 8) - quotient * mant_b;
+
+    /* 128 <= quotient < 512; bit 8 is set iff mant_a >= mant_b */
+    if (!(quotient & 0x100)) {
+        rem <<= 1;
+        quotient <<= 1;
+        if (rem >= mant_b) {
+            rem -= mant_b;
+            quotient |= 1;
+        }
+        exp--;
+    }
+    return bf16_round_pack(sign, exp, quotient << 22 | (rem != 0));
+}
+
+/* bf16_div for two normal operands */
+static inline bf16_t bf16_div_recip(bf16_t a, bf16_t b)
+{
+    return bf16_div_unpacked(
+        (a.bits ^ b.bits) >> 15,
+        (int32_t) ((a.bits >> 7) & 0xFF) - ((b.bits >> 7) & 0xFF) + BF16_EXP_BIAS,
+        (a.bits & 0x7F) | 0x80, (b.bits & 0x7F) | 0x80);
+}
+
+static inline bf16_t bf16_div(bf16_t a, bf16_t b)
+{
+    uint16_t sign_a = (a.bits >> 15) & 1;
+    uint16_t sign_b = (b.bits >> 15) & 1;
+    int32_t exp_a = ((a.bits >> 7) & 0xFF);
+    int32_t exp_b = ((b.bits >> 7) & 0xFF);
+    uint32_t mant_a = a.bits & 0x7F;
+    uint32_t mant_b = b.bits & 0x7F;
+
+    uint16_t result_sign = sign_a ^ sign_b;
+
+    if (exp_a == 0xFF && mant_a)
+        return a;
+    if (exp_b == 0xFF) {
+        if (mant_b)
+            return b;
+        /* Inf/Inf = NaN */
+        if (exp_a == 0xFF && !mant_a)
+            return BF16_NAN();
+        return (bf16_t) {.bits = result_sign << 15};
+    }
+    if (!exp_b && !mant_b) {
+        if (!exp_a && !mant_a)
+            return BF16_NAN();
+        return (bf16_t) {.bits = (result_sign << 15) | 0x7F80};
+    }
+    if (exp_a == 0xFF)
+        return (bf16_t) {.bits = (result_sign << 15) | 0x7F80};
+    if (!exp_a && !mant_a)
+        return (bf16_t) {.bits = result_sign << 15};
+
+    /* denormals normalized with one shift, exponents adjusted */
+    mant_a = bf16_unpack_mant(a, &exp_a);
+    mant_b = bf16_unpack_mant(b, &exp_b);
+
+    return bf16_div_unpacked(result_sign, exp_a - exp_b + BF16_EXP_BIAS,
+                             mant_a, mant_b);
+}
+
+/* ============= Finite-math variants =============
+ *
+ * bf16_add_finite and friends take the place of the full ops where the
+ * data is known to hold no Inf or NaN.  The operands are not checked for
+ * either, and denormals are flushed to zero on the way in and out: an
+ * operand with a zero exponent field counts as a signed zero, and a
+ * result that rounds to a denormal becomes a signed zero.  The one test
+ * left on the way in is that zero-exponent case; overflow still gives
+ * Inf.  With normal operands and a normal result they match the full ops
+ * bit for bit.  Given Inf or NaN the result is unspecified.  The full ops
+ * stay the default everywhere else in the library.
+ */
+static inline bf16_t bf16_flush_finite(bf16_t r)
+{
+    if (!(r.bits & BF16_EXP_MASK))
+        r.bits &= BF16_SIGN_MASK;
+    return r;
+}
+
+static inline bf16_t bf16_add_finite(bf16_t a, bf16_t b)
+{
+    uint32_t exp_a = (a.bits >> 7) & 0xFF, exp_b = (b.bits >> 7) & 0xFF;
+
+    if (!exp_a || !exp_b) {
+        if (exp_a)
+            return a;
+        if (exp_b)
+            return b;
+        return (bf16_t) {.bits = a.bits & b.bits & BF16_SIGN_MASK};
+    }
+    return bf16_flush_finite(bf16_add_unpacked(
+        a.bits >> 15, exp_a, (a.bits & 0x7F) | 0x80, b.bits >> 15, exp_b,
+        (b.bits & 0x7F) | 0x80));
+}
+
+static inline bf16_t bf16_sub_finite(bf16_t a, bf16_t b)
+{
+    b.bits ^= BF16_SIGN_MASK;
+    return bf16_add_finite(a, b);
+}
+
+static inline bf16_t bf16_mul_finite(bf16_t a, bf16_t b)
+{
+    uint32_t sign = (a.bits ^ b.bits) >> 15;
+    int32_t exp_a = (a.bits >> 7) & 0xFF, exp_b = (b.bits >> 7) & 0xFF;
+
+    if (!exp_a || !exp_b)
+        return (bf16_t) {.bits = sign << 15};
+    return bf16_flush_finite(
+        bf16_mul_unpacked(sign, exp_a + exp_b - BF16_EXP_BIAS,
+                          (a.bits & 0x7F) | 0x80, (b.bits & 0x7F) | 0x80));
+}
+
+/* A zero divisor gives a signed Inf, 0 / 0 included */
+static inline bf16_t bf16_div_finite(bf16_t a, bf16_t b)
+{
+    uint32_t sign = (a.bits ^ b.bits) >> 15;
+    int32_t exp_a = (a.bits >> 7) & 0xFF, exp_b = (b.bits >> 7) & 0xFF;
+
+    if (!exp_a || !exp_b)
+        return (bf16_t) {.bits = sign << 15 | (exp_b ? 0 : 0x7F80)};
+    return bf16_flush_finite(
+        bf16_div_unpacked(sign, exp_a - exp_b + BF16_EXP_BIAS,
+                          (a.bits & 0x7F) | 0x80, (b.bits & 0x7F) | 0x80));
+}
+
+/* ============= Square root ============= */
+
+/* bf16_sqrt and bf16_rsqrt follow fast_rsqrt() in quiz3_problemC: a node
+ * table, linear interpolation inside a segment, then a refinement step.
+ * An odd exponent is folded into the significand, so the radicand
+ * x = m << (7 + odd) always lies in [2^14, 2^16) and the exponent halves
+ * exactly.  The 33 nodes split that range into 16 segments per octave,
+ * indexed by the top 4 mantissa bits; the low 3 bits interpolate.  At 8
+ * bits of precision the interpolated seed is already within one unit, so
+ * the Newton step is replaced by a single exact integer check that
+ * gives the floor of the exact result.  A second check against the
+ * midpoint then rounds it to nearest like every other operation, through
+ * bf16_round_pack.  An irrational root never falls exactly on a midpoint,
+ * so there are no ties: a set guard bit always rounds up.
+ */
+extern const uint16_t bf16_sqrt_table[33];
+extern const uint16_t bf16_rsqrt_table[33];
+
+static inline bf16_t bf16_sqrt(bf16_t a)
+{
+    uint16_t sign = a.bits >> 15;
+    int32_t exp = (a.bits >> 7) & 0xFF;
+    uint32_t mant = a.bits & 0x7F;
+
+    if (exp == 0xFF)
+        return (mant || !sign) ? a : BF16_NAN();
+    if (!exp && !mant)
+        return a;
+    if (sign)
+        return BF16_NAN();
+
+    if (!exp) {
+        uint32_t sh = clz(mant) - 24;
+        mant = (mant << sh) & 0x7F;
+        exp = 1 - sh;
+    }
+
+    uint32_t odd = ~exp & 1;
+    uint32_t x = (mant | 0x80) << (7 + odd);
+    uint32_t k = (odd << 4) | (mant >> 3), f = mant & 7;
+
+    /* sqrt is concave and the nodes are rounded down: s never overshoots */
+    uint32_t lo = bf16_sqrt_table[k], hi = bf16_sqrt_table[k + 1];
+    uint32_t s = (lo + (((hi - lo) * f) >> 3)) >> 7;
+    if (s < 0xFF && bf16_mant_mul(s + 1, s + 1) <= x)
+        s++;
+
+    /* sqrt(x) >= s + 1/2 iff x >= s^2 + s + 1/4, i.e. x > s^2 + s */
+    uint32_t rem = x - bf16_mant_mul(s, s);
+    return bf16_round_pack(0, (exp + 127 - odd) >> 1,
+                           s << 23 | (rem > s) << 22 | (rem != 0));
+}
+
+static inline bf16_t bf16_rsqrt(bf16_t a)
+{
+    uint16_t sign = a.bits >> 15;
+    int32_t exp = (a.bits >> 7) & 0xFF;
+    uint32_t mant = a.bits & 0x7F;
+
+    if (exp == 0xFF) {
+        if (mant)
+            return a;
+        return sign ? BF16_NAN() : BF16_ZERO();
+    }
+    if (!exp && !mant)
+        return (bf16_t) {.bits = (sign << 15) | 0x7F80};
+    if (sign)
+        return BF16_NAN();
+
+    if (!exp) {
+        uint32_t sh = clz(mant) - 24;
+        mant = (mant << sh) & 0x7F;
+        exp = 1 - sh;
+    }
+
+    uint32_t odd = ~exp & 1;
+
+    /* Even powers of two have an exact power-of-two result */
+    if (!mant && !odd)
+        return (bf16_t) {.bits = ((381 - exp) >> 1) << 7};
+
+    uint32_t k = (odd << 4) | (mant >> 3), f = mant & 7;
+
+    /* 1/sqrt is convex and the nodes are rounded up: t never undershoots.
+     * t is the significand floor(2^15 / sqrt(x)), so t^2 * x <= 2^30,
+     * i.e. t^2 * (mant | 0x80) <= 2^(23 - odd).
+     */
+    uint32_t lo = bf16_rsqrt_table[k], hi = bf16_rsqrt_table[k + 1];
+    uint32_t t = (lo - (((lo - hi) * f) >> 3)) >> 7;
+    if (t > 0xFF || bf16_mant_mul(t, t) * (mant | 0x80) > (1U << (23 - odd)))
+        t--;
+
+    /* the exact value is at least t + 1/2 iff
+     * (2t + 1)^2 * (mant | 0x80) <= 2^(25 - odd)
+     */
+    uint32_t up = ((bf16_mant_mul(t, t) + t) * 4 + 1) * (mant | 0x80) <=
+                  (1U << (25 - odd));
+    return bf16_round_pack(0, (379 - exp + odd) >> 1, t << 23 | up << 22 | up);
+}
+
+/* ============= float32 conversion =============
+ *
+ * float32 values travel as their bit patterns: the target has no FPU and
+ * no soft-float library, so nothing here touches a float.  bf16 is the
+ * top half of a float32, which makes widening exact and narrowing a
+ * single rounding of the low 16 bits.
+ */
+
+/* Round to nearest, ties to even.  A carry out of the mantissa steps the
+ * exponent, up to Inf for the largest values; float32 denormals round
+ * the same way.  A NaN stays NaN (quieted, sign and top payload kept)
+ * even when its payload sits only in the low 16 bits.  No branches.
+ */
+static inline bf16_t f32_to_bf16(uint32_t f)
+{
+    uint32_t r = (f + 0x7FFF + ((f >> 16) & 1)) >> 16;
+    uint32_t nan = ((f & 0x7FFFFFFF) + 0x007FFFFF) >> 31;
+
+    r ^= (r ^ ((f >> 16) | 0x40)) & -nan;
+    return (bf16_t) {.bits = r};
+}
+
+static inline uint32_t bf16_to_f32(bf16_t a)
+{
+    return (uint32_t) a.bits << 16;
+}
+
+/* ============= Unpacked wide values ============= */
+
+/* A finite value held unpacked as sig * 2^(exp - 157): sig is 0 or has its
+ * leading one in bit 30, exp is the biased exponent with no range limit.
+ * That gives 31 significant bits, more than an fp32 accumulator, so
+ * products of two bf16 values are exact and sums lose only what falls
+ * below bit 0 (kept as a sticky bit).  Rounding happens once, in
+ * bf16_wide_pack().
+ */
+typedef struct {
+    uint32_t sign;
+    int32_t exp;
+    uint32_t sig;
+} bf16_wide_t;
+
+#define BF16_WIDE_ZERO() ((bf16_wide_t) {.sign = 0, .exp = 0, .sig = 0})
+
+/* Exact product of two finite non-zero values */
+static inline bf16_wide_t bf16_wide_mul(bf16_t a, bf16_t b)
+{
+    int32_t exp_a, exp_b;
+    uint32_t mant_a = bf16_unpack_mant(a, &exp_a);
+    uint32_t mant_b = bf16_unpack_mant(b, &exp_b);
+    uint32_t p = bf16_mant_mul(mant_a, mant_b);
+    bf16_wide_t r = {.sign = (a.bits ^ b.bits) >> 15};
+
+    if (p & 0x8000) {
+        r.sig = p << 15;
+        r.exp = exp_a + exp_b - BF16_EXP_BIAS + 1;
+    } else {
+        r.sig = p << 16;
+        r.exp = exp_a + exp_b - BF16_EXP_BIAS;
+    }
+    return r;
+}
+
+/* A finite value, zero included */
+static inline bf16_wide_t bf16_wide_from(bf16_t a)
+{
+    if (bf16_iszero(a))
+        return BF16_WIDE_ZERO();
+
+    bf16_wide_t r = {.sign = a.bits >> 15};
+    r.sig = bf16_unpack_mant(a, &r.exp) << 23;
+    return r;
+}
+
+static inline bf16_wide_t bf16_wide_add(bf16_wide_t x, bf16_wide_t y)
+{
+    if (!y.sig)
+        return x;
+    if (!x.sig)
+        return y;
+
+    if (x.exp < y.exp) {
+        bf16_wide_t t = x;
+        x = y;
+        y = t;
+    }
+
+    uint32_t d = x.exp - y.exp;
+    uint32_t sum;
+
+    if (x.sign != y.sign && d == 1) {
+        /* Possible deep cancellation: align exactly by moving x up into
+         * bit 31 instead of dropping a bit of y.
+         */
+        x.sig <<= 1;
+        x.exp--;
+    } else if (d >= 31) {
+        y.sig = 1;
+    } else if (d) {
+        y.sig = (y.sig >> d) | ((y.sig << (32 - d)) != 0);
+    }
+
+    if (x.sign == y.sign) {
+        sum = x.sig + y.sig;
+    } else if (x.sig >= y.sig) {
+        sum = x.sig - y.sig;
+    } else {
+        sum = y.sig - x.sig;
+        x.sign = y.sign;
+    }
+    if (!sum)
+        return BF16_WIDE_ZERO();
+
+    uint32_t lz = clz(sum);
+    if (!lz) {
+        sum = (sum >> 1) | (sum & 1);
+        x.exp++;
+    } else {
+        sum <<= lz - 1;
+        x.exp -= lz - 1;
+    }
+    x.sig = sum;
+    return x;
+}
+
+/* Round to bf16 like the other ops, to nearest with ties to even */
+static inline bf16_t bf16_wide_pack(bf16_wide_t x)
+{
+    if (!x.sig)
+        return (bf16_t) {.bits = x.sign << 15};
+    return bf16_round_pack(x.sign, x.exp, x.sig);
+}
+
+/* ============= Fused multiply-add ============= */
+
+/* a * b + c with a single rounding at the end */
+static inline bf16_t bf16_fma(bf16_t a, bf16_t b, bf16_t c)
+{
+    uint16_t prod_sign = (a.bits ^ b.bits) & BF16_SIGN_MASK;
+
+    if (bf16_isnan(a))
+        return a;
+    if (bf16_isnan(b))
+        return b;
+    if (bf16_isnan(c))
+        return c;
+
+    if (bf16_isinf(a) || bf16_isinf(b)) {
+        if (bf16_iszero(a) || bf16_iszero(b))
+            return BF16_NAN();
+        if (bf16_isinf(c) && (c.bits & BF16_SIGN_MASK) != prod_sign)
+            return BF16_NAN();
+        return (bf16_t) {.bits = prod_sign | 0x7F80};
+    }
+    if (bf16_isinf(c))
+        return c;
+
+    if (bf16_iszero(a) || bf16_iszero(b)) {
+        if (bf16_iszero(c))
+            return (bf16_t) {.bits = prod_sign & c.bits};
+        return c;
+    }
+
+    return bf16_wide_pack(bf16_wide_add(bf16_wide_mul(a, b), bf16_wide_from(c)));
+}
+
+#endif
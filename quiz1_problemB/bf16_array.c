@@ -0,0 +1,343 @@
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "bf16_array.h"
+
+/* ============= Normal-operand fast paths =============
+ *
+ * These are the scalar ops with every special-value branch removed.  They
+ * are only valid when both operands are normal finite numbers (biased
+ * exponent 1..254); the array kernels check that once per block and fall
+ * back to the full scalar op otherwise.
+ */
+
+/* 1 if bits is zero, denormal, Inf or NaN; computed without branches. */
+static inline uint32_t not_normal(uint16_t bits)
+{
+    return (uint16_t) ((bits & BF16_EXP_MASK) - 0x80) >= 0x7F00;
+}
+
+static inline uint32_t special4(const bf16_t *p)
+{
+    return not_normal(p[0].bits) | not_normal(p[1].bits) |
+           not_normal(p[2].bits) | not_normal(p[3].bits);
+}
+
+static inline bf16_t add_normal(bf16_t a, bf16_t b)
+{
+    return bf16_add_unpacked(a.bits >> 15, a.bits >> 7 & 0xFF,
+                             (a.bits & 0x7F) | 0x80, b.bits >> 15,
+                             b.bits >> 7 & 0xFF, (b.bits & 0x7F) | 0x80);
+}
+
+static inline bf16_t sub_normal(bf16_t a, bf16_t b)
+{
+    b.bits ^= BF16_SIGN_MASK;
+    return add_normal(a, b);
+}
+
+static inline bf16_t mul_normal(bf16_t a, bf16_t b)
+{
+    int32_t exp_a = (a.bits >> 7) & 0xFF;
+    int32_t exp_b = (b.bits >> 7) & 0xFF;
+
+    return bf16_mul_unpacked((a.bits ^ b.bits) >> 15,
+                             exp_a + exp_b - BF16_EXP_BIAS,
+                             (a.bits & 0x7F) | 0x80, (b.bits & 0x7F) | 0x80);
+}
+
+/* ============= Array kernels ============= */
+
+/* Four elements per iteration; a block containing any special operand is
+ * handed to the scalar op element by element, the tail likewise.
+ */
+#define BF16_BINARY_KERNEL(name, op, fast)                                 \
+    void name(bf16_t *dst, const bf16_t *a, const bf16_t *b, size_t n)     \
+    {                                                                      \
+        size_t i = 0;                                                      \
+                                                                           \
+        for (; i + 4 <= n; i += 4) {                                       \
+            if (special4(a + i) | special4(b + i)) {                       \
+                dst[i] = op(a[i], b[i]);                                   \
+                dst[i + 1] = op(a[i + 1], b[i + 1]);                       \
+                dst[i + 2] = op(a[i + 2], b[i + 2]);                       \
+                dst[i + 3] = op(a[i + 3], b[i + 3]);                       \
+                continue;                                                  \
+            }                                                              \
+            dst[i] = fast(a[i], b[i]);                                     \
+            dst[i + 1] = fast(a[i + 1], b[i + 1]);                         \
+            dst[i + 2] = fast(a[i + 2], b[i + 2]);                         \
+            dst[i + 3] = fast(a[i + 3], b[i + 3]);                         \
+        }                                                                  \
+        for (; i < n; i++)                                                 \
+            dst[i] = op(a[i], b[i]);                                       \
+    }
+
+BF16_BINARY_KERNEL(bf16_add_n, bf16_add, add_normal)
+BF16_BINARY_KERNEL(bf16_sub_n, bf16_sub, sub_normal)
+BF16_BINARY_KERNEL(bf16_mul_n, bf16_mul, mul_normal)
+BF16_BINARY_KERNEL(bf16_div_n, bf16_div, bf16_div_recip)
+
+/* The product may underflow to zero or a denormal, so it is re-checked
+ * before taking the fast add.
+ */
+static inline bf16_t axpy_normal(bf16_t alpha, bf16_t x, bf16_t y)
+{
+    bf16_t p = mul_normal(alpha, x);
+    if (not_normal(p.bits))
+        return bf16_add(p, y);
+    return add_normal(p, y);
+}
+
+void bf16_axpy_n(bf16_t *y, bf16_t alpha, const bf16_t *x, size_t n)
+{
+    size_t i = 0;
+
+    if (!not_normal(alpha.bits)) {
+        for (; i + 4 <= n; i += 4) {
+            if (special4(x + i) | special4(y + i)) {
+                y[i] = bf16_add(bf16_mul(alpha, x[i]), y[i]);
+                y[i + 1] = bf16_add(bf16_mul(alpha, x[i + 1]), y[i + 1]);
+                y[i + 2] = bf16_add(bf16_mul(alpha, x[i + 2]), y[i + 2]);
+                y[i + 3] = bf16_add(bf16_mul(alpha, x[i + 3]), y[i + 3]);
+                continue;
+            }
+            y[i] = axpy_normal(alpha, x[i], y[i]);
+            y[i + 1] = axpy_normal(alpha, x[i + 1], y[i + 1]);
+            y[i + 2] = axpy_normal(alpha, x[i + 2], y[i + 2]);
+            y[i + 3] = axpy_normal(alpha, x[i + 3], y[i + 3]);
+        }
+    }
+    for (; i < n; i++)
+        y[i] = bf16_add(bf16_mul(alpha, x[i]), y[i]);
+}
+
+void bf16_scale_n(bf16_t *dst, bf16_t alpha, const bf16_t *x, size_t n)
+{
+    size_t i = 0;
+
+    if (!not_normal(alpha.bits)) {
+        for (; i + 4 <= n; i += 4) {
+            if (special4(x + i)) {
+                dst[i] = bf16_mul(alpha, x[i]);
+                dst[i + 1] = bf16_mul(alpha, x[i + 1]);
+                dst[i + 2] = bf16_mul(alpha, x[i + 2]);
+                dst[i + 3] = bf16_mul(alpha, x[i + 3]);
+                continue;
+            }
+            dst[i] = mul_normal(alpha, x[i]);
+            dst[i + 1] = mul_normal(alpha, x[i + 1]);
+            dst[i + 2] = mul_normal(alpha, x[i + 2]);
+            dst[i + 3] = mul_normal(alpha, x[i + 3]);
+        }
+    }
+    for (; i < n; i++)
+        dst[i] = bf16_mul(alpha, x[i]);
+}
+
+/* A NaN or infinite product: fold it into the special result so far */
+static uint16_t dot_special(uint16_t special, bf16_t a, bf16_t b)
+{
+    bf16_t p = bf16_mul(a, b);
+    if (!special)
+        return p.bits;
+    return bf16_add((bf16_t) {.bits = special}, p).bits;
+}
+
+bf16_t bf16_dot_stride(const bf16_t *a,
+                       size_t a_stride,
+                       const bf16_t *b,
+                       size_t b_stride,
+                       size_t n)
+{
+    bf16_wide_t acc = BF16_WIDE_ZERO();
+    uint16_t special = 0;
+
+    for (; n; n--, a += a_stride, b += b_stride) {
+        if ((a->bits & BF16_EXP_MASK) == BF16_EXP_MASK ||
+            (b->bits & BF16_EXP_MASK) == BF16_EXP_MASK) {
+            special = dot_special(special, *a, *b);
+            continue;
+        }
+        if (bf16_iszero(*a) || bf16_iszero(*b))
+            continue;
+        acc = bf16_wide_add(acc, bf16_wide_mul(*a, *b));
+    }
+
+    if (special)
+        return (bf16_t) {.bits = special};
+    return bf16_wide_pack(acc);
+}
+
+bf16_t bf16_dot(const bf16_t *a, const bf16_t *b, size_t n)
+{
+    return bf16_dot_stride(a, 1, b, 1, n);
+}
+
+/* ============= Reductions ============= */
+
+/* A NaN or infinite element: fold it into the special result so far */
+static uint16_t sum_special(uint16_t special, bf16_t a)
+{
+    if (!special)
+        return a.bits;
+    return bf16_add((bf16_t) {.bits = special}, a).bits;
+}
+
+bf16_t bf16_sum_n(const bf16_t *a, size_t n)
+{
+    bf16_wide_t acc = BF16_WIDE_ZERO();
+    uint16_t special = 0;
+
+    for (; n; n--, a++) {
+        if ((a->bits & BF16_EXP_MASK) == BF16_EXP_MASK) {
+            special = sum_special(special, *a);
+            continue;
+        }
+        acc = bf16_wide_add(acc, bf16_wide_from(*a));
+    }
+
+    if (special)
+        return (bf16_t) {.bits = special};
+    return bf16_wide_pack(acc);
+}
+
+/* sqrt(x) for a wide x >= 0, rounded once.  With the power of two made
+ * even, sig (or 2 sig) is a 31- or 32-bit integer whose integer square
+ * root has 16 bits; a non-zero remainder becomes the sticky bit.
+ */
+static bf16_t wide_sqrt(bf16_wide_t x)
+{
+    if (!x.sig)
+        return BF16_ZERO();
+
+    int32_t e = x.exp - 157;
+    uint32_t v = x.sig, r = 0;
+
+    if (e & 1) {
+        v <<= 1;
+        e--;
+    }
+    for (uint32_t bit = 1U << 30; bit; bit >>= 2) {
+        if (v >= r + bit) {
+            v -= r + bit;
+            r = (r >> 1) + bit;
+        } else {
+            r >>= 1;
+        }
+    }
+    /* r * 2^(e / 2), r in [2^15, 2^16) */
+    return bf16_round_pack(0, 142 + (e >> 1), (r << 15) | (v != 0));
+}
+
+bf16_t bf16_norm2_n(const bf16_t *a, size_t n)
+{
+    bf16_wide_t acc = BF16_WIDE_ZERO();
+    uint16_t special = 0;
+
+    for (; n; n--, a++) {
+        if ((a->bits & BF16_EXP_MASK) == BF16_EXP_MASK) {
+            /* |a|: a NaN stays a NaN and takes over from Inf */
+            if (!bf16_isnan((bf16_t) {.bits = special}))
+                special = a->bits & 0x7FFF;
+            continue;
+        }
+        if (bf16_iszero(*a))
+            continue;
+        acc = bf16_wide_add(acc, bf16_wide_mul(*a, *a));
+    }
+
+    if (special)
+        return (bf16_t) {.bits = special};
+    return wide_sqrt(acc);
+}
+
+/* Keys above that of +Inf and at or below this bound are NaNs */
+#define BF16_KEY_INF 0xFF80
+#define BF16_KEY_BELOW_NEG_INF 0x007E
+
+size_t bf16_argmax_n(const bf16_t *a, size_t n)
+{
+    uint32_t best = BF16_KEY_BELOW_NEG_INF;
+    size_t idx = n;
+
+    for (size_t i = 0; i < n; i++) {
+        uint32_t k = bf16_key(a[i]);
+
+        if (k > best && k <= BF16_KEY_INF) {
+            best = k;
+            idx = i;
+        }
+    }
+    return idx;
+}
+
+bf16_t bf16_max_n(const bf16_t *a, size_t n)
+{
+    size_t i = bf16_argmax_n(a, n);
+
+    if (i < n)
+        return a[i];
+    return n ? a[0] : (bf16_t) {.bits = 0xFF80};
+}
+
+/* ============= float32 conversion ============= */
+
+void f32_to_bf16_n(bf16_t *dst, const uint32_t *src, size_t n)
+{
+    size_t i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        uint32_t f0 = src[i], f1 = src[i + 1], f2 = src[i + 2], f3 = src[i + 3];
+        dst[i] = f32_to_bf16(f0);
+        dst[i + 1] = f32_to_bf16(f1);
+        dst[i + 2] = f32_to_bf16(f2);
+        dst[i + 3] = f32_to_bf16(f3);
+    }
+    for (; i < n; i++)
+        dst[i] = f32_to_bf16(src[i]);
+}
+
+void bf16_to_f32_n(uint32_t *dst, const bf16_t *src, size_t n)
+{
+    size_t i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+        uint32_t b0 = src[i].bits, b1 = src[i + 1].bits;
+        uint32_t b2 = src[i + 2].bits, b3 = src[i + 3].bits;
+        dst[i] = b0 << 16;
+        dst[i + 1] = b1 << 16;
+        dst[i + 2] = b2 << 16;
+        dst[i + 3] = b3 << 16;
+    }
+    for (; i < n; i++)
+        dst[i] = bf16_to_f32(src[i]);
+}
+
+/* ============= Radix sort ============= */
+
+/* One counting pass: dst = src stably ordered by key byte (key >> shift) */
+static void radix_pass(bf16_t *dst, const bf16_t *src, size_t n, unsigned shift)
+{
+    /* static: 1 KiB would be a quarter of the 4 KiB stack */
+    static size_t count[256];
+    size_t i, sum = 0;
+
+    for (i = 0; i < 256; i++)
+        count[i] = 0;
+    for (i = 0; i < n; i++)
+        count[(bf16_key(src[i]) >> shift) & 0xFF]++;
+    for (i = 0; i < 256; i++) {
+        size_t c = count[i];
+        count[i] = sum;
+        sum += c;
+    }
+    for (i = 0; i < n; i++)
+        dst[count[(bf16_key(src[i]) >> shift) & 0xFF]++] = src[i];
+}
+
+void bf16_sort_n(bf16_t *a, bf16_t *tmp, size_t n)
+{
+    radix_pass(tmp, a, n, 0);
+    radix_pass(a, tmp, n, 8);
+}
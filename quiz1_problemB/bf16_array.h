@@ -0,0 +1,63 @@
+#ifndef BF16_ARRAY_H
+#define BF16_ARRAY_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "bf16.h"
+
+/* Element-wise kernels over contiguous bf16 buffers.
+ * The output may alias an input exactly, but must not partially overlap it.
+ * Results are bit-identical to calling the scalar op on each element.
+ */
+void bf16_add_n(bf16_t *dst, const bf16_t *a, const bf16_t *b, size_t n);
+void bf16_sub_n(bf16_t *dst, const bf16_t *a, const bf16_t *b, size_t n);
+void bf16_mul_n(bf16_t *dst, const bf16_t *a, const bf16_t *b, size_t n);
+void bf16_div_n(bf16_t *dst, const bf16_t *a, const bf16_t *b, size_t n);
+
+/* y[i] = alpha * x[i] + y[i] */
+void bf16_axpy_n(bf16_t *y, bf16_t alpha, const bf16_t *x, size_t n);
+
+/* dst[i] = alpha * x[i] */
+void bf16_scale_n(bf16_t *dst, bf16_t alpha, const bf16_t *x, size_t n);
+
+/* sum of a[i] * b[i], accumulated unpacked and rounded once at the end */
+bf16_t bf16_dot(const bf16_t *a, const bf16_t *b, size_t n);
+
+/* bf16_dot over a[i * a_stride] and b[i * b_stride], e.g. a matrix column */
+bf16_t bf16_dot_stride(const bf16_t *a,
+                       size_t a_stride,
+                       const bf16_t *b,
+                       size_t b_stride,
+                       size_t n);
+
+/* Reductions.  bf16_sum_n and bf16_norm2_n accumulate in a bf16_wide_t and
+ * round once at the end, like bf16_dot: an exact zero sum is +0, a NaN
+ * anywhere gives NaN and an infinity gives that infinity (NaN for +Inf
+ * and -Inf together).  The norm squares without overflow and takes the
+ * square root of the wide sum, so sqrt(sum a[i]^2) is rounded once too.
+ */
+bf16_t bf16_sum_n(const bf16_t *a, size_t n);
+bf16_t bf16_norm2_n(const bf16_t *a, size_t n);
+
+/* Index of the first largest element in bf16_key() order, so -0 and +0
+ * tie; NaNs are skipped and n is returned if no element is a number.
+ * bf16_max_n returns that element, a NaN if there is none, and -Inf for
+ * n = 0.
+ */
+size_t bf16_argmax_n(const bf16_t *a, size_t n);
+bf16_t bf16_max_n(const bf16_t *a, size_t n);
+
+/* float32 bit patterns to bf16, rounded to nearest even (f32_to_bf16),
+ * and back (exact).  Four elements per iteration.
+ */
+void f32_to_bf16_n(bf16_t *dst, const uint32_t *src, size_t n);
+void bf16_to_f32_n(uint32_t *dst, const bf16_t *src, size_t n);
+
+/* Sort a into ascending bf16_key() order: two stable LSD radix passes on
+ * the key bytes, a -> tmp -> a.  -0 and +0 keep their input order, NaNs
+ * go to the end of their sign.  tmp holds n elements.
+ */
+void bf16_sort_n(bf16_t *a, bf16_t *tmp, size_t n);
+
+#endif
@@ -0,0 +1,13 @@
+#ifndef BF16_ASM_H
+#define BF16_ASM_H
+
+#include "bf16.h"
+
+/* bf16_asm.S: hand-scheduled RV32I versions of the core ops, bit-identical
+ * to bf16_add / bf16_sub / bf16_mul.
+ */
+bf16_t bf16_add_asm(bf16_t a, bf16_t b);
+bf16_t bf16_sub_asm(bf16_t a, bf16_t b);
+bf16_t bf16_mul_asm(bf16_t a, bf16_t b);
+
+#endif
@@ -0,0 +1,15 @@
+#include <stdint.h>
+
+#include "bf16.h"
+
+/* Reciprocal table behind bf16_div(), filled in by the compiler */
+
+#define RECIP(m) ((0x1000000U + ((m) | 0x80) - 1) / ((m) | 0x80))
+#define RECIP4(m) RECIP(m), RECIP((m) + 1), RECIP((m) + 2), RECIP((m) + 3)
+#define RECIP16(m) \
+    RECIP4(m), RECIP4((m) + 4), RECIP4((m) + 8), RECIP4((m) + 12)
+
+const uint32_t bf16_recip_table[128] = {
+    RECIP16(0),  RECIP16(16), RECIP16(32), RECIP16(48),
+    RECIP16(64), RECIP16(80), RECIP16(96), RECIP16(112),
+};
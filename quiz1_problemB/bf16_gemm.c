@@ -0,0 +1,172 @@
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "bf16_array.h"
+#include "bf16_gemm.h"
+
+/* ============= Packing =============
+ *
+ * The microkernel never sees a bf16_t.  Operands are unpacked once here
+ * into one word each:
+ *
+ *   exp << 16 | sign << 8 | mant
+ *
+ * with mant including the hidden bit (denormals normalized, exp adjusted)
+ * and the word 0 for a zero value.  B operands carry exp - 127, so the
+ * kernel gets the product exponent from a single add of the two words.
+ * Padding past the matrix edge is 0 and contributes nothing.
+ *
+ * Accumulators are pairs (w, e): w = sign << 31 | sig, e = exp, the
+ * bf16_wide_t value held in two words.
+ */
+
+#define GEMM_TILE_WORDS (BF16_GEMM_MR * BF16_GEMM_NR * 2)
+#define GEMM_ACC_ROW_WORDS (BF16_GEMM_MR * BF16_GEMM_NC * 2)
+
+static uint32_t gemm_a_pack[BF16_GEMM_MC * BF16_GEMM_KC];
+static uint32_t gemm_b_pack[BF16_GEMM_KC * BF16_GEMM_NC];
+static uint32_t gemm_acc[BF16_GEMM_MC * BF16_GEMM_NC * 2];
+
+static inline uint32_t gemm_pack(bf16_t x, int32_t bias)
+{
+    int32_t exp;
+
+    if (bf16_iszero(x))
+        return 0;
+    uint32_t mant = bf16_unpack_mant(x, &exp);
+    return (uint32_t) (exp - bias) << 16 | (x.bits >> 15) << 8 | mant;
+}
+
+/* mc x kc block of A into MR-row panels, MR words per k step */
+static void gemm_pack_a(const bf16_t *a, size_t lda, size_t mc, size_t kc)
+{
+    uint32_t *dst = gemm_a_pack;
+
+    for (size_t i = 0; i < mc; i += BF16_GEMM_MR) {
+        for (size_t p = 0; p < kc; p++) {
+            const bf16_t *src = a + p;
+            for (size_t r = 0; r < BF16_GEMM_MR; r++, src += lda)
+                *dst++ = i + r < mc ? gemm_pack(*src, 0) : 0;
+        }
+        for (size_t r = 0; r < BF16_GEMM_MR; r++)
+            a += lda;
+    }
+}
+
+/* kc x nc block of B into NR-column panels, NR words per k step */
+static void gemm_pack_b(const bf16_t *b, size_t ldb, size_t kc, size_t nc)
+{
+    uint32_t *dst = gemm_b_pack;
+
+    for (size_t j = 0; j < nc; j += BF16_GEMM_NR, b += BF16_GEMM_NR) {
+        const bf16_t *src = b;
+        for (size_t p = 0; p < kc; p++, src += ldb) {
+            for (size_t r = 0; r < BF16_GEMM_NR; r++)
+                *dst++ = j + r < nc ? gemm_pack(src[r], BF16_EXP_BIAS) : 0;
+        }
+    }
+}
+
+/* ============= Blocking ============= */
+
+static void gemm_clear_acc(size_t mc, size_t nc)
+{
+    uint32_t *row = gemm_acc;
+
+    for (size_t i = 0; i < mc; i += BF16_GEMM_MR, row += GEMM_ACC_ROW_WORDS) {
+        uint32_t *w = row;
+        for (size_t j = 0; j < nc; j += BF16_GEMM_NR) {
+            for (size_t t = 0; t < GEMM_TILE_WORDS; t++)
+                *w++ = 0;
+        }
+    }
+}
+
+/* Every MR x NR tile of the block against the packed panels */
+static void gemm_macro(size_t mc, size_t nc, size_t kc)
+{
+    const uint32_t *ap = gemm_a_pack;
+    uint32_t *row = gemm_acc;
+    size_t a_step = kc * BF16_GEMM_MR, b_step = kc * BF16_GEMM_NR;
+
+    for (size_t i = 0; i < mc; i += BF16_GEMM_MR) {
+        const uint32_t *bp = gemm_b_pack;
+        uint32_t *acc = row;
+        for (size_t j = 0; j < nc; j += BF16_GEMM_NR) {
+            bf16_gemm_kernel_2x4(kc, ap, bp, acc);
+            bp += b_step;
+            acc += GEMM_TILE_WORDS;
+        }
+        ap += a_step;
+        row += GEMM_ACC_ROW_WORDS;
+    }
+}
+
+static void gemm_store(bf16_t *c, size_t ldc, size_t mc, size_t nc)
+{
+    for (size_t i = 0; i < mc; i++, c += ldc) {
+        const uint32_t *acc = gemm_acc +
+                              (i / BF16_GEMM_MR) * GEMM_ACC_ROW_WORDS +
+                              (i % BF16_GEMM_MR) * BF16_GEMM_NR * 2;
+        for (size_t j = 0; j < nc; j += BF16_GEMM_NR) {
+            for (size_t r = 0; r < BF16_GEMM_NR && j + r < nc; r++) {
+                uint32_t w = acc[2 * r];
+                c[j + r] = bf16_wide_pack((bf16_wide_t) {
+                    .sign = w >> 31,
+                    .exp = (int32_t) acc[2 * r + 1],
+                    .sig = w & 0x7FFFFFFF,
+                });
+            }
+            acc += GEMM_TILE_WORDS;
+        }
+    }
+}
+
+/* The kernel handles finite values only */
+static bool gemm_has_special(const bf16_t *x, size_t ld, size_t rows, size_t cols)
+{
+    for (; rows; rows--, x += ld) {
+        for (size_t j = 0; j < cols; j++) {
+            if ((x[j].bits & BF16_EXP_MASK) == BF16_EXP_MASK)
+                return true;
+        }
+    }
+    return false;
+}
+
+void bf16_gemm(size_t m,
+               size_t n,
+               size_t k,
+               const bf16_t *a,
+               size_t lda,
+               const bf16_t *b,
+               size_t ldb,
+               bf16_t *c,
+               size_t ldc)
+{
+    if (gemm_has_special(a, lda, m, k) || gemm_has_special(b, ldb, k, n)) {
+        for (size_t i = 0; i < m; i++, a += lda, c += ldc) {
+            for (size_t j = 0; j < n; j++)
+                c[j] = bf16_dot_stride(a, 1, b + j, ldb, k);
+        }
+        return;
+    }
+
+    for (size_t jc = 0; jc < n; jc += BF16_GEMM_NC) {
+        size_t nc = n - jc < BF16_GEMM_NC ? n - jc : BF16_GEMM_NC;
+
+        for (size_t ic = 0; ic < m; ic += BF16_GEMM_MC) {
+            size_t mc = m - ic < BF16_GEMM_MC ? m - ic : BF16_GEMM_MC;
+
+            gemm_clear_acc(mc, nc);
+            for (size_t pc = 0; pc < k; pc += BF16_GEMM_KC) {
+                size_t kc = k - pc < BF16_GEMM_KC ? k - pc : BF16_GEMM_KC;
+
+                gemm_pack_b(b + pc * ldb + jc, ldb, kc, nc);
+                gemm_pack_a(a + ic * lda + pc, lda, mc, kc);
+                gemm_macro(mc, nc, kc);
+            }
+            gemm_store(c + ic * ldc + jc, ldc, mc, nc);
+        }
+    }
+}
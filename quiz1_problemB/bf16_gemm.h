@@ -0,0 +1,41 @@
+#ifndef BF16_GEMM_H
+#define BF16_GEMM_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "bf16.h"
+
+/* Register tile of the assembly microkernel and the cache blocking of the
+ * driver.  MC and NC must be multiples of MR and NR.
+ */
+#define BF16_GEMM_MR 2
+#define BF16_GEMM_NR 4
+#define BF16_GEMM_MC 32
+#define BF16_GEMM_NC 64
+#define BF16_GEMM_KC 128
+
+/* C = A * B for row-major A (m x k), B (k x n) and C (m x n); lda, ldb
+ * and ldc are row strides in elements.  Each C element is rounded exactly
+ * like bf16_dot() over its row of A and column of B.
+ */
+void bf16_gemm(size_t m,
+               size_t n,
+               size_t k,
+               const bf16_t *a,
+               size_t lda,
+               const bf16_t *b,
+               size_t ldb,
+               bf16_t *c,
+               size_t ldc);
+
+/* bf16_gemm_asm.S: acc += A panel * B panel over k steps for one MR x NR
+ * tile.  The panels hold packed operands, acc holds MR * NR (w, e) pairs;
+ * see bf16_gemm.c for both formats.
+ */
+void bf16_gemm_kernel_2x4(size_t k,
+                          const uint32_t *a,
+                          const uint32_t *b,
+                          uint32_t *acc);
+
+#endif
@@ -0,0 +1,223 @@
+#include <stdint.h>
+
+#include "bf16_math.h"
+
+/* log2(e) * 2^23, ln(2) * 2^24 */
+#define BF16_LOG2E_Q23 12102203U
+#define BF16_LN2_Q24 11629080U
+
+/* gelu: |w| * log2(e) = |x| * (A + B * x^2), A = 2 sqrt(2 / pi) log2(e),
+ * B = 0.044715 A; A * 2^23 and B * 2^18
+ */
+#define BF16_GELU_A_Q23 19312322U
+#define BF16_GELU_B_Q18 26986U
+
+/* ============= Fixed-point helpers ============= */
+
+/* Round val * 2^scale to bf16, val != 0 */
+static inline bf16_t round_fixed(uint32_t sign, uint32_t val, int32_t scale)
+{
+    unsigned lz = clz(val);
+
+    return bf16_round_pack(sign, 158 + scale - lz, (val << lz) >> 1);
+}
+
+/* 2^t for t in Q23: returns 2^f in Q16, 2^16 <= v < 2^17, and *n, with
+ * t = n + f, 0 <= f < 1.  The top 6 bits of f pick the segment.
+ */
+static inline uint32_t exp2_q23(int32_t t, int32_t *n)
+{
+    uint32_t f = t & 0x7FFFFF, k = f >> 17, r = f & 0x1FFFF;
+    uint32_t lo = bf16_exp2_table[k], hi = bf16_exp2_table[k + 1];
+
+    *n = t >> 23;
+    return lo + ((r * (hi - lo)) >> 17);
+}
+
+/* 1 / (1 + e) in Q16, for e in Q16 with 0 <= e <= 1 */
+static inline uint32_t recip1p_q16(uint32_t e)
+{
+    if (e >= 0x10000)
+        return 0x8000;
+
+    uint32_t k = e >> 10, r = e & 0x3FF;
+    uint32_t lo = bf16_recip1p_table[k], hi = bf16_recip1p_table[k + 1];
+
+    return lo - ((r * (lo - hi)) >> 10);
+}
+
+/* sigmoid(w) for |w| = t / log2(e), t >= 0 in Q23, w < 0 if neg.  Returns
+ * val and *scale with sigmoid(w) = val * 2^*scale and 2^30 <= val < 2^32.
+ * For w < 0 the result is e^w / (1 + e^w) with e^w unscaled, so it keeps
+ * its precision down to the underflow.
+ */
+static uint32_t sigmoid_q23(uint32_t neg, int32_t t, int32_t *scale)
+{
+    int32_t n;
+    uint32_t v = exp2_q23(-t, &n);
+
+    /* e^-|w| = v * 2^(n - 16), n <= 0; e is the same in Q16 */
+    uint32_t e = n > -17 ? v >> -n : 0;
+    uint32_t g = recip1p_q16(e);
+
+    if (neg) {
+        *scale = n - 31;
+        return (v >> 1) * g;
+    }
+    *scale = -31;
+    return 0x80000000U - ((e * g) >> 1);
+}
+
+/* ============= Functions ============= */
+
+bf16_t bf16_exp(bf16_t a)
+{
+    uint32_t sign = a.bits >> 15;
+    int32_t exp = (a.bits >> 7) & 0xFF;
+    uint32_t mant = a.bits & 0x7F;
+
+    if (exp == 0xFF) {
+        if (mant)
+            return a;
+        return sign ? BF16_ZERO() : a;
+    }
+    /* |x| < 2^-9: e^x is within half a unit of 1 */
+    if (exp < 118)
+        return bf16_one;
+    /* |x| >= 128: out of range either way */
+    if (exp > 133)
+        return sign ? BF16_ZERO() : (bf16_t) {.bits = 0x7F80};
+
+    /* t = |x| * log2(e) in Q23, below 2^31 for |x| < 128 */
+    int32_t t = (BF16_LOG2E_Q23 * (mant | 0x80)) >> (134 - exp);
+    int32_t n;
+    uint32_t v = exp2_q23(sign ? -t : t, &n);
+
+    return bf16_round_pack(0, 127 + n, v << 14);
+}
+
+bf16_t bf16_log(bf16_t a)
+{
+    uint32_t sign = a.bits >> 15;
+    int32_t exp = (a.bits >> 7) & 0xFF;
+    uint32_t mant = a.bits & 0x7F;
+
+    if (exp == 0xFF)
+        return (mant || !sign) ? a : BF16_NAN();
+    if (!exp && !mant)
+        return (bf16_t) {.bits = 0xFF80};
+    if (sign)
+        return BF16_NAN();
+
+    uint32_t m = bf16_unpack_mant(a, &exp);
+
+    /* ln(x) = (exp - 127) ln(2) + ln(1 + mantissa) in Q24; the second term
+     * is below ln(2), so the sign is that of exp - 127 (+ for x = 1)
+     */
+    int32_t e = exp - BF16_EXP_BIAS;
+    uint32_t y = BF16_LN2_Q24 * (e < 0 ? -e : e);
+    uint32_t frac = bf16_log_table[m & 0x7F];
+
+    if (e < 0)
+        return round_fixed(1, y - frac, -24);
+    y += frac;
+    if (!y)
+        return BF16_ZERO();
+    return round_fixed(0, y, -24);
+}
+
+bf16_t bf16_sigmoid(bf16_t a)
+{
+    uint32_t sign = a.bits >> 15;
+    int32_t exp = (a.bits >> 7) & 0xFF;
+    uint32_t mant = a.bits & 0x7F;
+
+    if (exp == 0xFF) {
+        if (mant)
+            return a;
+        return sign ? BF16_ZERO() : bf16_one;
+    }
+    /* |x| < 2^-9: within half a unit of 0.5 */
+    if (exp < 118)
+        return (bf16_t) {.bits = 0x3F00};
+    if (exp > 133)
+        return sign ? BF16_ZERO() : bf16_one;
+
+    int32_t t = (BF16_LOG2E_Q23 * (mant | 0x80)) >> (134 - exp);
+    int32_t scale;
+    uint32_t s = sigmoid_q23(sign, t, &scale);
+
+    return round_fixed(0, s, scale);
+}
+
+bf16_t bf16_tanh(bf16_t a)
+{
+    uint32_t sign = a.bits >> 15;
+    int32_t exp = (a.bits >> 7) & 0xFF;
+    uint32_t mant = a.bits & 0x7F;
+    bf16_t one = {.bits = (sign << 15) | 0x3F80};
+
+    if (exp == 0xFF)
+        return mant ? a : one;
+    if (!exp && !mant)
+        return a;
+
+    /* |x| < 2^-4: x - x^3 / 3, the next term is below 2^-18 relative.
+     * The correction x^2 / 3 is below 2^-9, so 8 bits of it suffice.
+     */
+    if (exp < 123) {
+        uint32_t m = bf16_unpack_mant(a, &exp);
+        uint32_t sig = m << 23, sh = 245 - 2 * exp;
+
+        if (sh < 32) {
+            uint32_t c = (bf16_mant_mul(m, m) * 21845) >> 16;
+            sig -= (c * m) >> sh;
+        }
+        return bf16_round_pack(sign, exp, sig);
+    }
+    /* |x| >= 8: 1 - tanh(x) < 2^-22 */
+    if (exp > 129)
+        return one;
+
+    /* e = e^-2|x| in Q16; tanh(|x|) = (1 - e) / (1 + e) */
+    int32_t t = (BF16_LOG2E_Q23 * (mant | 0x80)) >> (133 - exp);
+    int32_t n;
+    uint32_t e = exp2_q23(-t, &n) >> -n;
+
+    if (!e)
+        return one;
+    return round_fixed(sign, (0x10000 - e) * recip1p_q16(e), -32);
+}
+
+bf16_t bf16_gelu(bf16_t a)
+{
+    uint32_t sign = a.bits >> 15;
+    int32_t exp = (a.bits >> 7) & 0xFF;
+    uint32_t mant = a.bits & 0x7F;
+
+    if (exp == 0xFF)
+        return (mant || !sign) ? a : (bf16_t) {.bits = 0x8000};
+    if (!exp && !mant)
+        return a;
+    /* x >= 3: sigmoid(w) is within 2^-9 of 1 and the result rounds to x;
+     * x <= -11: the result is below half the smallest denormal
+     */
+    if (!sign && a.bits >= 0x4040)
+        return a;
+    if (sign && a.bits >= 0xC130)
+        return (bf16_t) {.bits = 0x8000};
+
+    uint32_t m = bf16_unpack_mant(a, &exp);
+
+    /* s = A + B x^2 in Q23, then t = |x| s, below 2^31 for |x| < 11 */
+    uint32_t s = BF16_GELU_A_Q23, sh = 263 - 2 * exp;
+    if (sh < 32)
+        s += (bf16_mant_mul(m, m) * BF16_GELU_B_Q18) >> sh;
+    sh = 130 - exp;
+    int32_t t = sh < 32 ? ((s >> 4) * m) >> sh : 0;
+
+    int32_t scale;
+    uint32_t sg = sigmoid_q23(sign, t, &scale);
+
+    return round_fixed(sign, (sg >> 8) * m, exp - 126 + scale);
+}
@@ -0,0 +1,52 @@
+#ifndef BF16_MATH_H
+#define BF16_MATH_H
+
+#include <stdint.h>
+
+#include "bf16.h"
+
+/* ============= Transcendental functions =============
+ *
+ * Each function splits its argument into exponent and 8-bit significand
+ * and works in fixed point from there, so none of them goes through
+ * bf16_mul or bf16_div.  The result is rounded once, by bf16_round_pack.
+ *
+ *   exp      e^x = 2^(x * log2(e)); the integer part of the power goes to
+ *            the exponent, 2^f for the fraction is interpolated in a
+ *            64-segment table
+ *   log      exponent * ln(2) + ln(1 + mantissa), the second term read
+ *            from a 128-entry table, one entry per mantissa: no
+ *            interpolation needed
+ *   sigmoid  from e = e^-|x|: 1 / (1 + e) is interpolated in a second
+ *            64-segment table, then sigmoid(x) = e / (1 + e) for x < 0
+ *            and 1 - e / (1 + e) for x >= 0
+ *   tanh     (1 - e) / (1 + e) with e = e^-2|x|; below 2^-4 the series
+ *            x - x^3 / 3 instead, where 1 - e would cancel
+ *   gelu     the tanh form, 0.5 x (1 + tanh(sqrt(2 / pi) (x + 0.044715
+ *            x^3))), evaluated as x * sigmoid(2 sqrt(2 / pi) (x + ...))
+ *
+ * The interpolation error of both tables is below 2^-16 relative, well
+ * under the 2^-9 of half a bf16 unit.  Error bound, checked on all 2^16
+ * inputs against libm in double ("make verify"): 1 ulp, i.e. every result
+ * is the correctly rounded one or its neighbour.  The misses are the
+ * inputs whose exact result lies within about 2^-14 of a halfway point:
+ *
+ *   exp 2, log 0, sigmoid 15, tanh 12, gelu 14 of 65536
+ *
+ * Special values: exp(-Inf) = 0, sigmoid(+-Inf) = 1 / 0, tanh(+-Inf) =
+ * +-1, log of a negative number is NaN and log(+-0) = -Inf, gelu(-Inf)
+ * is -0, the limit.  NaN in gives NaN out.
+ */
+#define BF16_MATH_MAX_ULP 1
+
+bf16_t bf16_exp(bf16_t a);
+bf16_t bf16_log(bf16_t a);
+bf16_t bf16_sigmoid(bf16_t a);
+bf16_t bf16_tanh(bf16_t a);
+bf16_t bf16_gelu(bf16_t a);
+
+extern const uint32_t bf16_exp2_table[65];
+extern const uint32_t bf16_recip1p_table[65];
+extern const uint32_t bf16_log_table[128];
+
+#endif
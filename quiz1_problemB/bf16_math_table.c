@@ -0,0 +1,54 @@
+#include <stdint.h>
+
+#include "bf16_math.h"
+
+/* Tables for bf16_math.c.  The interpolated ones have 64 segments over
+ * [0, 1]; node k sits at k / 64.
+ */
+
+/* round(2^(k / 64) * 2^16) */
+const uint32_t bf16_exp2_table[65] = {
+    65536, 66250, 66971, 67700, 68438, 69183, 69936, 70698, 71468,
+    72246, 73032, 73828, 74632, 75444, 76266, 77096, 77936, 78785,
+    79642, 80510, 81386, 82273, 83169, 84074, 84990, 85915, 86851,
+    87796, 88752, 89719, 90696, 91684, 92682, 93691, 94711, 95743,
+    96785, 97839, 98905, 99982, 101070, 102171, 103283, 104408, 105545,
+    106694, 107856, 109031, 110218, 111418, 112631, 113858, 115098, 116351,
+    117618, 118899, 120194, 121502, 122825, 124163, 125515, 126882, 128263,
+    129660, 131072,
+};
+
+/* round(2^16 / (1 + k / 64)) */
+const uint32_t bf16_recip1p_table[65] = {
+    65536, 64528, 63550, 62602, 61681, 60787, 59919, 59075, 58254,
+    57456, 56680, 55924, 55188, 54471, 53773, 53092, 52429, 51782,
+    51150, 50534, 49932, 49345, 48771, 48210, 47663, 47127, 46603,
+    46091, 45590, 45100, 44620, 44151, 43691, 43240, 42799, 42367,
+    41943, 41528, 41121, 40721, 40330, 39946, 39569, 39199, 38836,
+    38480, 38130, 37787, 37449, 37118, 36792, 36472, 36158, 35849,
+    35545, 35246, 34953, 34664, 34380, 34100, 33825, 33554, 33288,
+    33026, 32768,
+};
+
+/* round(ln(1 + j / 128) * 2^24), one entry per 7-bit mantissa */
+const uint32_t bf16_log_table[128] = {
+    0, 130563, 260117, 388679, 516263, 642884, 768556,
+    893295, 1017112, 1140023, 1262040, 1383175, 1503443, 1622854,
+    1741421, 1859157, 1976071, 2092177, 2207485, 2322006, 2435750,
+    2548728, 2660951, 2772428, 2883169, 2993184, 3102482, 3211073,
+    3318965, 3426168, 3532691, 3638541, 3743728, 3848259, 3952143,
+    4055388, 4158001, 4259990, 4361364, 4462128, 4562291, 4661859,
+    4760840, 4859240, 4957067, 5054326, 5151025, 5247170, 5342767,
+    5437822, 5532342, 5626332, 5719799, 5812748, 5905184, 5997115,
+    6088544, 6179477, 6269921, 6359879, 6449358, 6538362, 6626896,
+    6714966, 6802576, 6889730, 6976434, 7062693, 7148510, 7233890,
+    7318838, 7403359, 7487455, 7571132, 7654394, 7737245, 7819688,
+    7901728, 7983370, 8064615, 8145469, 8225936, 8306018, 8385720,
+    8465045, 8543997, 8622579, 8700794, 8778647, 8856140, 8933277,
+    9010061, 9086495, 9162582, 9238326, 9313729, 9388795, 9463527,
+    9537927, 9611998, 9685745, 9759168, 9832271, 9905058, 9977530,
+    10049690, 10121541, 10193086, 10264327, 10335266, 10405907, 10476252,
+    10546303, 10616063, 10685534, 10754719, 10823619, 10892237, 10960577,
+    11028638, 11096425, 11163939, 11231183, 11298158, 11364866, 11431311,
+    11497493, 11563416,
+};
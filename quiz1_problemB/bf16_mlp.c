@@ -0,0 +1,34 @@
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "bf16_array.h"
+#include "bf16_mlp.h"
+
+void bf16_mlp_layer(bf16_t *y,
+                    const bf16_t *w,
+                    const bf16_t *bias,
+                    const bf16_t *x,
+                    size_t n_out,
+                    size_t n_in,
+                    bool relu)
+{
+    for (size_t r = 0; r < n_out; r++, w += n_in) {
+        bf16_t v = bf16_add(bf16_dot(w, x, n_in), bias[r]);
+
+        if (relu && (v.bits >> 15) && !bf16_isnan(v))
+            v = BF16_ZERO();
+        y[r] = v;
+    }
+}
+
+void bf16_mlp_forward(bf16_t *y, const bf16_t *x)
+{
+    bf16_t h1[BF16_MLP_H1], h2[BF16_MLP_H2];
+
+    bf16_mlp_layer(h1, bf16_mlp_w1, bf16_mlp_b1, x, BF16_MLP_H1, BF16_MLP_IN,
+                   true);
+    bf16_mlp_layer(h2, bf16_mlp_w2, bf16_mlp_b2, h1, BF16_MLP_H2, BF16_MLP_H1,
+                   true);
+    bf16_mlp_layer(y, bf16_mlp_w3, bf16_mlp_b3, h2, BF16_MLP_OUT, BF16_MLP_H2,
+                   false);
+}
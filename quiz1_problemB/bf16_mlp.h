@@ -0,0 +1,53 @@
+#ifndef BF16_MLP_H
+#define BF16_MLP_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "bf16.h"
+
+/* ============= MLP inference workload =============
+ *
+ * A fixed 64-32-32-10 multilayer perceptron.  Every layer is a
+ * matrix-vector product plus bias,
+ *
+ *   y[r] = bf16_add(bf16_dot(W row r, x), b[r])
+ *
+ * followed by a ReLU on the two hidden layers; the output layer is left
+ * linear.  The dot product rounds once, the bias add once more.  Weights,
+ * biases and a batch of sample inputs are in bf16_mlp_weights.c.
+ */
+#define BF16_MLP_IN 64
+#define BF16_MLP_H1 32
+#define BF16_MLP_H2 32
+#define BF16_MLP_OUT 10
+#define BF16_MLP_BATCH 8
+
+/* multiply-adds of one forward pass */
+#define BF16_MLP_MACS                                         \
+    (BF16_MLP_IN * BF16_MLP_H1 + BF16_MLP_H1 * BF16_MLP_H2 + \
+     BF16_MLP_H2 * BF16_MLP_OUT)
+
+extern bf16_t bf16_mlp_w1[BF16_MLP_H1 * BF16_MLP_IN];
+extern bf16_t bf16_mlp_b1[BF16_MLP_H1];
+extern bf16_t bf16_mlp_w2[BF16_MLP_H2 * BF16_MLP_H1];
+extern bf16_t bf16_mlp_b2[BF16_MLP_H2];
+extern bf16_t bf16_mlp_w3[BF16_MLP_OUT * BF16_MLP_H2];
+extern bf16_t bf16_mlp_b3[BF16_MLP_OUT];
+extern bf16_t bf16_mlp_input[BF16_MLP_BATCH * BF16_MLP_IN];
+
+/* y = W x + bias for row-major W (n_out x n_in), then max(y, 0) per
+ * element if relu.  The ReLU sends -0 to +0 and keeps NaN.
+ */
+void bf16_mlp_layer(bf16_t *y,
+                    const bf16_t *w,
+                    const bf16_t *bias,
+                    const bf16_t *x,
+                    size_t n_out,
+                    size_t n_in,
+                    bool relu);
+
+/* One forward pass: BF16_MLP_IN inputs to BF16_MLP_OUT outputs */
+void bf16_mlp_forward(bf16_t *y, const bf16_t *x);
+
+#endif
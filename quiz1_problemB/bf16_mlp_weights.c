@@ -0,0 +1,605 @@
+#include "bf16_mlp.h"
+
+/* Weights and inputs of the bf16_mlp workload, deliberately writable so
+ * that they live in .data.  Drawn from xorshift32 with seed 0x2545F491,
+ * in order w1, b1, w2, b2, w3, b3, input, and rounded to bf16: weights
+ * uniform in +-sqrt(6 / (fan_in + fan_out)), biases in +-1/8, inputs in
+ * [0, 1).
+ */
+
+/* layer 1: 32 x 64, row-major, one row per output */
+bf16_t bf16_mlp_w1[BF16_MLP_H1 * BF16_MLP_IN] = {
+    {0x3E42}, {0x3CBA}, {0xBD59}, {0xBE80}, {0x3E65}, {0x3E7E}, {0x3CA9},
+    {0xBE5B}, {0x3D33}, {0xBDE4}, {0xBE58}, {0x3D6E}, {0x3CE1}, {0x3D72},
+    {0xBE33}, {0x3E50}, {0x3E5E}, {0xBDD6}, {0xBE5B}, {0x3DA7}, {0x3E79},
+    {0xBE06}, {0x3C8E}, {0xBC65}, {0x3CD2}, {0xBD65}, {0xBE72}, {0x3E54},
+    {0xBE7F}, {0xBD9C}, {0xBDA1}, {0xBE53}, {0x3E3B}, {0xBCF2}, {0xBDB5},
+    {0xBE25}, {0x3E4E}, {0xBE70}, {0xBD9A}, {0x3E2A}, {0x3E39}, {0x3D94},
+    {0xBDDF}, {0x3CB4}, {0x3E73}, {0x3E56}, {0xBE00}, {0xBD20}, {0x3D96},
+    {0xBE11}, {0x3D30}, {0xBDA3}, {0xBE3E}, {0x3E6E}, {0xBE41}, {0x3E5E},
+    {0xBDB5}, {0x3E04}, {0xBDEF}, {0xBCB5}, {0x3DCE}, {0xBE6E}, {0xBDDF},
+    {0xBD5E}, {0xBDB2}, {0xBE25}, {0x3E4D}, {0x3D94}, {0xBE5E}, {0x3E5B},
+    {0xBDA8}, {0xBD6B}, {0xBD08}, {0xBE3E}, {0x3E15}, {0x3E38}, {0x3E64},
+    {0x3E21}, {0xBE58}, {0x3D94}, {0x3E08}, {0xBDF2}, {0x3D89}, {0xBDDA},
+    {0x3DE4}, {0x3E1C}, {0xBE61}, {0x3D95}, {0xBE51}, {0xBD3F}, {0x3DD6},
+    {0x3E64}, {0xBDC7}, {0xBDE0}, {0x3E20}, {0x3E63}, {0xBDC9}, {0xBC91},
+    {0xBDE3}, {0xBD8E}, {0x3E75}, {0x3DCB}, {0x3E55}, {0x3E03}, {0x3DCC},
+    {0xBE6C}, {0x3E46}, {0x3D76}, {0x3C0B}, {0xBC8A}, {0x3E2E}, {0xBE20},
+    {0x3D9E}, {0xBDA4}, {0xBDF4}, {0x3CFA}, {0xBCE4}, {0xBE08}, {0x3E7B},
+    {0x3DDD}, {0xBE42}, {0x3E6A}, {0x3D32}, {0xBE34}, {0x3D9B}, {0x3DFA},
+    {0xBE56}, {0xBE45}, {0x3D55}, {0x3DE6}, {0xBE54}, {0x3E32}, {0xBE0E},
+    {0xBE19}, {0x3E76}, {0xBE2F}, {0xBE31}, {0xBD07}, {0xBE54}, {0xBDBC},
+    {0x3E34}, {0x3DE1}, {0x3E75}, {0xBD35}, {0x3E31}, {0x3E18}, {0xBD90},
+    {0x3CE9}, {0xBE04}, {0xBD59}, {0xBD3A}, {0x3CD3}, {0xBE2C}, {0xBE22},
+    {0xBE05}, {0x3E70}, {0x3E76}, {0x3E16}, {0x3E20}, {0x3DDD}, {0x3E38},
+    {0x3E24}, {0xBDED}, {0xBD06}, {0x3E10}, {0x3E69}, {0xBDBB}, {0xBCDF},
+    {0xBE3C}, {0x3E1A}, {0x3E74}, {0xBE31}, {0x3D06}, {0xBD69}, {0x3E58},
+    {0x3E02}, {0xBE24}, {0xBD85}, {0x3E70}, {0x3E7E}, {0x3E37}, {0x3E01},
+    {0xBDAD}, {0x3D72}, {0x3E6E}, {0xBDD1}, {0x3D6F}, {0xBE3F}, {0x3DB9},
+    {0x3E5E}, {0xBE1E}, {0xBDDD}, {0xBE31}, {0x3E61}, {0xBE48}, {0x3DF2},
+    {0x3E43}, {0x3E6F}, {0x3C30}, {0xBE76}, {0x3E53}, {0xBD86}, {0x3CEB},
+    {0xBD2F}, {0xBD97}, {0x3E6A}, {0x3E21}, {0x3DFA}, {0xBE62}, {0xBE7E},
+    {0x3E3B}, {0x3C93}, {0x3E14}, {0xBE16}, {0x3E66}, {0xBE25}, {0x3D8C},
+    {0xBD37}, {0xBE4A}, {0xBE23}, {0xBE15}, {0xBD93}, {0x3D72}, {0x3E43},
+    {0xBE0A}, {0x3D0F}, {0xBE0C}, {0x3E4A}, {0x3E5C}, {0xBE79}, {0xBDC5},
+    {0x3E66}, {0x3E2A}, {0xBC93}, {0x3E7A}, {0x3E76}, {0xBE6D}, {0xBC20},
+    {0x3E1F}, {0xBC9B}, {0xBDDF}, {0x3D06}, {0xBDC2}, {0x3E76}, {0xBDD4},
+    {0xBD11}, {0x3D63}, {0x3DB4}, {0xBE5A}, {0xBE21}, {0xBDA6}, {0xBD9D},
+    {0xBE5E}, {0xBE27}, {0x3E56}, {0x3D95}, {0x3DE8}, {0x3DBB}, {0xBE3F},
+    {0xBDFD}, {0x3DF2}, {0x3E39}, {0x3C99}, {0xBE5B}, {0x3D9E}, {0xBE2F},
+    {0xBD9B}, {0x3D1F}, {0xBDB9}, {0xBE25}, {0x3E0F}, {0xBE74}, {0xBE4A},
+    {0x3E7C}, {0x3DA3}, {0xBE53}, {0x3D42}, {0xBD09}, {0xBE42}, {0xBC48},
+    {0xBDB6}, {0xBD0D}, {0xBE64}, {0x3D7E}, {0xBE26}, {0x3DA7}, {0xBD44},
+    {0x3E6D}, {0xBD1E}, {0x3DB8}, {0xBC96}, {0x3DB6}, {0xBDF5}, {0xBDBB},
+    {0x3E78}, {0x3E2C}, {0x3B46}, {0x3E3D}, {0x3E45}, {0x3E5D}, {0x3E79},
+    {0x3DC6}, {0xBDC0}, {0x3DBF}, {0x3D7D}, {0xBE37}, {0xBE1E}, {0xBE10},
+    {0x3E07}, {0x3E5C}, {0xBDB1}, {0x3DF9}, {0xBE25}, {0x3DDD}, {0x3E21},
+    {0xBB29}, {0x3E5A}, {0x3B64}, {0x3DB6}, {0x3D9E}, {0x3D83}, {0x3E21},
+    {0xBDAA}, {0xBC97}, {0x3CFA}, {0x3D8D}, {0xBE70}, {0x3D61}, {0xBCD9},
+    {0x3DF7}, {0x3E12}, {0x3DA3}, {0xBC82}, {0xBD33}, {0x3DAA}, {0x3D64},
+    {0x3DB8}, {0xBDD5}, {0x3E3B}, {0xBE3A}, {0xBDDB}, {0xBDA3}, {0xBE72},
+    {0x3E59}, {0xBE72}, {0xBAAD}, {0xBDDB}, {0x3E24}, {0x3E02}, {0xBE22},
+    {0xBE31}, {0x3E50}, {0x3C8C}, {0xBDB9}, {0x3DF6}, {0x3E31}, {0xBE58},
+    {0xBE5E}, {0x3E65}, {0xBE2D}, {0xBCCE}, {0xBDF0}, {0x3E02}, {0xBE0A},
+    {0xBDBD}, {0x3E77}, {0x3DEE}, {0xBD1D}, {0xBE33}, {0xBE5B}, {0x3E2E},
+    {0x3E39}, {0x3DDD}, {0xBDF1}, {0x3E03}, {0xBE16}, {0x3DF8}, {0x3D27},
+    {0xBD3A}, {0xBDE0}, {0x3CFF}, {0xBD92}, {0x3E46}, {0xBDCB}, {0xBE76},
+    {0x3E1C}, {0xBE45}, {0x3DD8}, {0x3DE8}, {0xBDD0}, {0xBE77}, {0x3E67},
+    {0xBDC0}, {0xBD66}, {0xBE3B}, {0xBE47}, {0x3E33}, {0xBD98}, {0x3E06},
+    {0x3E68}, {0xBDC2}, {0xBD8A}, {0xBD8F}, {0xBD95}, {0x3DE2}, {0xBE40},
+    {0xBE52}, {0x3E51}, {0x3DE3}, {0xBE73}, {0xBD9B}, {0x3B3C}, {0x3D43},
+    {0xBDB7}, {0x3E18}, {0xBC09}, {0x3DBF}, {0xBE54}, {0xBD88}, {0x3E5B},
+    {0x3D49}, {0xBD34}, {0xBE71}, {0xBE5E}, {0xBE0B}, {0xBDF8}, {0xBCAB},
+    {0xBCBB}, {0xBE42}, {0xBD85}, {0xBE2E}, {0xBD9A}, {0x3DF3}, {0xBBDB},
+    {0x3E2E}, {0xBDBA}, {0xBE73}, {0xBE07}, {0xBD11}, {0xBE47}, {0xBC93},
+    {0xBD7C}, {0xBE33}, {0x3DD0}, {0xBDFA}, {0x3DD5}, {0xBE4A}, {0xBE41},
+    {0xBD96}, {0xBDE4}, {0x3E14}, {0xBE33}, {0xBD0E}, {0xBE39}, {0x3E45},
+    {0xBD4E}, {0xBE4C}, {0x3E36}, {0x3E16}, {0x3E44}, {0x3E18}, {0xBDE8},
+    {0xBE2E}, {0xBE39}, {0xBDB7}, {0xBDFF}, {0x3E50}, {0xBE27}, {0xBE46},
+    {0xBDA5}, {0x3E67}, {0xBE5C}, {0x3E28}, {0xBDEB}, {0x3E80}, {0xBD97},
+    {0x3E3C}, {0x3D9C}, {0xBD45}, {0x3CDD}, {0x3DA3}, {0x3E51}, {0x3D97},
+    {0x3E52}, {0xBE69}, {0xBDBC}, {0xBD7F}, {0xBE0C}, {0xBE69}, {0xBD46},
+    {0x3E51}, {0xBE05}, {0x3E25}, {0xBE5C}, {0x3E3B}, {0xBD73}, {0x3E61},
+    {0x3E7C}, {0x3E10}, {0x3E65}, {0xBD0D}, {0xBDA1}, {0xBC30}, {0xBDE1},
+    {0xBCB6}, {0x3D20}, {0x3D1D}, {0x3DE9}, {0xBD8F}, {0x3DD3}, {0x3E1A},
+    {0xBDC9}, {0x3E43}, {0x3E3C}, {0xBD22}, {0xBE55}, {0xBDC5}, {0xBD64},
+    {0xBD5A}, {0xBD7B}, {0xBDFF}, {0x3E80}, {0x3E34}, {0xBE3B}, {0xBD6B},
+    {0x3DAA}, {0xBE5A}, {0xBE13}, {0xBE5E}, {0x3DC7}, {0xBE6D}, {0x3E4B},
+    {0x3E5F}, {0xBE50}, {0xBD6C}, {0xBE19}, {0x3DB8}, {0x3DCA}, {0xBE52},
+    {0x3E68}, {0x3A8D}, {0xBE6C}, {0xBDBD}, {0xBCC0}, {0x3E6B}, {0xBE0A},
+    {0x3E54}, {0xBE09}, {0x3C64}, {0xBE7D}, {0xBE62}, {0x3E35}, {0xBD20},
+    {0xBD65}, {0xBD19}, {0x3B27}, {0xBCA1}, {0xBD80}, {0xBE27}, {0xBDF0},
+    {0x3C85}, {0xBDCE}, {0x3E61}, {0xBE0F}, {0x3E77}, {0x3DC7}, {0xBE30},
+    {0xBDA5}, {0x3DDB}, {0xBCF0}, {0xBE5B}, {0x3CC5}, {0xBCD1}, {0x3D10},
+    {0xBD3F}, {0x3D6B}, {0xBE0F}, {0x3E5B}, {0x3E1E}, {0xBE5A}, {0xBCBC},
+    {0x3E09}, {0xBBC6}, {0x3DFD}, {0xBB97}, {0xBE33}, {0x3B81}, {0xBC7A},
+    {0xBE4E}, {0xBD86}, {0x3E6C}, {0x3E07}, {0x3D97}, {0x3DF6}, {0xBACB},
+    {0xBE51}, {0x3E77}, {0xBE30}, {0xBD33}, {0x3E7B}, {0xBD2E}, {0x3DA1},
+    {0xBD2E}, {0xBD5C}, {0x3E67}, {0x3E19}, {0xBDA5}, {0xBE78}, {0xBDB5},
+    {0xBD5E}, {0x3BAC}, {0x3E04}, {0x3DFA}, {0x3D4B}, {0xBDE9}, {0xBE0B},
+    {0xBE10}, {0xBD2C}, {0x3E77}, {0x3E07}, {0x3E54}, {0xBDBC}, {0x3DFA},
+    {0x3E27}, {0xBE14}, {0xBD86}, {0x3E3B}, {0x3E15}, {0x3DA8}, {0x3DC2},
+    {0x3E54}, {0xBE06}, {0x3E1B}, {0xBE5C}, {0x3DFB}, {0x3E1E}, {0x3C66},
+    {0x3DE8}, {0x3E0A}, {0x3D7E}, {0xBDFE}, {0x3D90}, {0xBE57}, {0x3E07},
+    {0x3DE5}, {0xBE19}, {0x3E69}, {0xBE23}, {0xBDB0}, {0xBE48}, {0xBCC1},
+    {0x3DFF}, {0x3E62}, {0x3D00}, {0x3DEA}, {0xBD91}, {0xBD11}, {0x3DAA},
+    {0x3DA3}, {0x3E59}, {0x3E39}, {0xBE32}, {0x3E2D}, {0xBCC9}, {0x3E0F},
+    {0x3E68}, {0xBDCB}, {0xBDBD}, {0x3E34}, {0xBDC9}, {0x3E58}, {0x3CA6},
+    {0xBD8A}, {0x3D9F}, {0x3CC1}, {0x3DD2}, {0x3DA6}, {0x3E34}, {0x3E7E},
+    {0x3E21}, {0x3D7B}, {0xBE0A}, {0xBD7B}, {0x3E38}, {0x3DD2}, {0xBE12},
+    {0x3E14}, {0xBC84}, {0x3E0B}, {0x3E6D}, {0xBE26}, {0xBE27}, {0x3DD8},
+    {0xBD27}, {0xBE08}, {0x3E54}, {0x3D82}, {0xBDC2}, {0x3E47}, {0x3E7E},
+    {0x3C98}, {0x3E1B}, {0xBDAB}, {0x3DD3}, {0xBE67}, {0xBDE1}, {0x3E30},
+    {0xBDE0}, {0x3DB1}, {0x3CF3}, {0x3E74}, {0xBE60}, {0xBD68}, {0xBE32},
+    {0xBE08}, {0x3D54}, {0x3C82}, {0xBE39}, {0x3DFA}, {0xBDB3}, {0x3D8D},
+    {0xBE63}, {0x3D9B}, {0x3E03}, {0xBE14}, {0x3DA2}, {0x3E1E}, {0xBE17},
+    {0xBD1F}, {0x3E7B}, {0xBE02}, {0x3E56}, {0xBE49}, {0x3CB4}, {0x3E0A},
+    {0xBE08}, {0x3E12}, {0x3DC6}, {0xBE2A}, {0xBDEF}, {0xBE54}, {0xBE6B},
+    {0x3E1A}, {0x3DD9}, {0x3D04}, {0xBE69}, {0xBDD4}, {0x3E0A}, {0xBD85},
+    {0xBCF2}, {0xBE7B}, {0x3E30}, {0x3DB6}, {0xBDDD}, {0xBC24}, {0xBDD3},
+    {0xBE75}, {0xBB49}, {0xBDBD}, {0x3E76}, {0x3E13}, {0xBD3F}, {0xBE50},
+    {0xBDAB}, {0x3E76}, {0x3E39}, {0xBDE5}, {0xBE7A}, {0x3E2F}, {0xBE39},
+    {0xBE80}, {0xBE0A}, {0xBD32}, {0x3D07}, {0xBE33}, {0xBDB2}, {0xBCD0},
+    {0x3DE0}, {0xBE09}, {0xBDCC}, {0xBC0A}, {0xBCB7}, {0xBE53}, {0xBDB3},
+    {0xBE1E}, {0x3D5F}, {0x3D95}, {0xBE74}, {0x3E36}, {0x3DD5}, {0x3DC2},
+    {0x3CE7}, {0xBE52}, {0xBE35}, {0xBE12}, {0x3E53}, {0x3C52}, {0x3DF3},
+    {0xBE29}, {0xBDB1}, {0xBDA7}, {0xBDA8}, {0x3E01}, {0x3CE7}, {0xBE01},
+    {0xBE22}, {0xBE7A}, {0xBC70}, {0xBE7D}, {0xBE50}, {0x3D3D}, {0xBE6A},
+    {0xBCE1}, {0xBE52}, {0xBD5F}, {0xBE51}, {0x3E29}, {0xBC3A}, {0x3DFB},
+    {0xBD98}, {0xBD8E}, {0xBE06}, {0x3C58}, {0x3DCF}, {0x3E79}, {0xBDC0},
+    {0x3E4C}, {0x3E01}, {0xBE01}, {0xBE2E}, {0xBDA6}, {0xBE50}, {0x3E1F},
+    {0xBC5B}, {0xBD2F}, {0x3C10}, {0x3E7D}, {0xBE10}, {0xBE07}, {0x3DD3},
+    {0xBDD7}, {0x3D3A}, {0xBE26}, {0xBE66}, {0xBE75}, {0x3D9F}, {0x3E3B},
+    {0xBE60}, {0xBE45}, {0x3E59}, {0x3E7E}, {0xBE3A}, {0xBE5E}, {0x3DA4},
+    {0xBE22}, {0x3DA1}, {0xBDC2}, {0x3B87}, {0xBE68}, {0x3D07}, {0x3E11},
+    {0xBDEB}, {0x3D62}, {0xBE25}, {0xBE02}, {0x3DE2}, {0x3E02}, {0xBCA5},
+    {0xBDD1}, {0x3D6C}, {0xBC9F}, {0xBE5E}, {0xBD05}, {0xBE67}, {0xBCD0},
+    {0xBBA5}, {0x3DF6}, {0xBE74}, {0x3E6C}, {0xBDDE}, {0x3E37}, {0xBDC6},
+    {0xBD6E}, {0x3E20}, {0xBCBE}, {0x3E59}, {0xBD7E}, {0x3E54}, {0x3DD9},
+    {0xBDBD}, {0xBD88}, {0x3E03}, {0x3DD0}, {0x3E20}, {0xBE62}, {0xBD7B},
+    {0x3AFE}, {0xBE48}, {0x3D44}, {0xBDC4}, {0xBE5A}, {0x3D65}, {0x3CBA},
+    {0x3CED}, {0x3E55}, {0x3D1A}, {0xBDA8}, {0x3E39}, {0x3D09}, {0x3DD5},
+    {0xBE08}, {0x3CB1}, {0x3E04}, {0x3E15}, {0xBDCF}, {0x3E20}, {0x3E24},
+    {0xBDA8}, {0xBDEB}, {0x3E20}, {0x3D80}, {0xBD97}, {0x3D82}, {0xBD88},
+    {0xBE11}, {0x3DC7}, {0x3DD0}, {0x3E05}, {0x3E4A}, {0x3E1E}, {0xBC08},
+    {0xBDEA}, {0xBC94}, {0x3D38}, {0x3E7B}, {0x3E4C}, {0x3DBD}, {0x3E29},
+    {0xBE1A}, {0xBE29}, {0x3D5A}, {0xBCD7}, {0xBD38}, {0xBE34}, {0x3DE6},
+    {0x3DFA}, {0xBE4C}, {0xBDF6}, {0xBE69}, {0x3E3F}, {0x3E2C}, {0xBE51},
+    {0x3E35}, {0xBE1B}, {0x3E6A}, {0xBE42}, {0x3E77}, {0x3E51}, {0x3DDD},
+    {0x3DD4}, {0x3DC8}, {0x3E40}, {0x3DB1}, {0xBD68}, {0x3D57}, {0xBDF5},
+    {0x3BA2}, {0x3E3C}, {0xBCEC}, {0xBD3F}, {0xBE21}, {0x3E77}, {0xBE1A},
+    {0x3E07}, {0xBCE7}, {0xBDE5}, {0x3D27}, {0x3E1C}, {0xBDAD}, {0xBE64},
+    {0x3E3F}, {0x3E4B}, {0xBDB9}, {0xBCDC}, {0x3D8F}, {0x3E23}, {0xBE7D},
+    {0xBDC3}, {0xBD06}, {0x3E71}, {0xBDE1}, {0x3E52}, {0x3E05}, {0x3E1E},
+    {0xBD3B}, {0xBE4E}, {0x3D5F}, {0xBDD7}, {0x3B8B}, {0xBD0A}, {0x3E4C},
+    {0xBE15}, {0x3DCA}, {0x3E02}, {0x3D3C}, {0xBCA6}, {0x3E3E}, {0xBD9F},
+    {0x3E2A}, {0x3DD8}, {0x3D0D}, {0x3E1B}, {0xBE3F}, {0x3E41}, {0x3E17},
+    {0x3DD0}, {0xBD6F}, {0x3D26}, {0x3DB9}, {0xBE26}, {0x3DB6}, {0xBDF2},
+    {0xBE16}, {0x3E63}, {0x3E36}, {0x3E11}, {0xBD86}, {0xBDF4}, {0xBD37},
+    {0x3D7C}, {0xBDCC}, {0xBE06}, {0xBE6E}, {0xBCD7}, {0xBD92}, {0x3D7B},
+    {0x3E61}, {0xBC08}, {0xBD94}, {0x3E18}, {0xBD1D}, {0xBE3A}, {0xBE6D},
+    {0x3E59}, {0xBDEC}, {0x3BE7}, {0x3E45}, {0x3DC4}, {0x3E26}, {0xBE48},
+    {0x3E13}, {0x3E24}, {0xBE67}, {0x3E69}, {0x3CA8}, {0x3DA1}, {0xBCA3},
+    {0x3E13}, {0x3E7C}, {0x3DB3}, {0x3DD0}, {0x3D86}, {0x3E25}, {0x3D20},
+    {0x3E38}, {0x3DF0}, {0xBE4C}, {0x3C37}, {0xBE69}, {0x3E16}, {0xBE5C},
+    {0x3DFA}, {0xBE0E}, {0xBE58}, {0xBDD5}, {0xBDEE}, {0x3DB5}, {0x3E80},
+    {0xBE0E}, {0x3DDB}, {0xBE19}, {0xBDCC}, {0x3D55}, {0xBD9D}, {0x3BB3},
+    {0x3E17}, {0x3E61}, {0x3B77}, {0x3E79}, {0x3D92}, {0xBE5C}, {0x3DAC},
+    {0xBD58}, {0x3DDE}, {0xBE02}, {0x3D74}, {0x3D08}, {0x3DC8}, {0xBC6F},
+    {0xBE2E}, {0x3D77}, {0xBDA5}, {0xBE3B}, {0x3E18}, {0x3E65}, {0xBE54},
+    {0x3D86}, {0x3E3C}, {0xBCD8}, {0xBD78}, {0xBE71}, {0x3E4D}, {0x3E5E},
+    {0xBD28}, {0x3E44}, {0x3C1F}, {0xBE2B}, {0xBDF0}, {0x3D24}, {0xBE08},
+    {0x3E50}, {0xBE51}, {0xBD62}, {0xBE20}, {0xBE1D}, {0x3D32}, {0xBC3A},
+    {0x3D2C}, {0xBE3E}, {0xBDC5}, {0x3D1F}, {0x3E49}, {0xBE37}, {0xBE45},
+    {0xBD9E}, {0xBE4F}, {0x3E18}, {0xBD81}, {0xBD89}, {0x3B9C}, {0x3C88},
+    {0xBB9C}, {0xBE04}, {0x3D20}, {0x3BC0}, {0x3D0D}, {0x3E33}, {0x3E16},
+    {0xBD4D}, {0xBD9D}, {0xBD8A}, {0xBE67}, {0x3E4D}, {0x3E25}, {0x3E5B},
+    {0x3D7D}, {0x3D85}, {0xBDEA}, {0xBE3E}, {0xBD62}, {0xBE15}, {0xBD23},
+    {0xBD2B}, {0x3E65}, {0xBE2C}, {0x3C42}, {0xBE12}, {0xBE77}, {0xBCA7},
+    {0xBDDD}, {0xBE4D}, {0x3E33}, {0xBE3B}, {0x3D88}, {0xBE53}, {0x3D95},
+    {0xBE5D}, {0xBE34}, {0x3D1E}, {0xBDB7}, {0x3E3E}, {0xBE2E}, {0x3E16},
+    {0xBE5A}, {0x3D3B}, {0x3E7A}, {0x3E7C}, {0x3DB7}, {0x3DA1}, {0xBD04},
+    {0x3E3F}, {0xBE61}, {0x3E55}, {0xBE04}, {0x3CF7}, {0x3D32}, {0x3E14},
+    {0x3CB3}, {0xBD0E}, {0x3E0F}, {0x3E6B}, {0x3DCD}, {0x3CB5}, {0x3E3C},
+    {0x3D8E}, {0x3DD3}, {0x3E3F}, {0x3DB4}, {0x3D0B}, {0xBE4D}, {0xBE79},
+    {0x3DA9}, {0xBE1D}, {0xBD61}, {0x3E70}, {0x3E05}, {0xBE22}, {0x3E26},
+    {0xBB90}, {0x3D22}, {0x3DDA}, {0xBE5A}, {0xBDDE}, {0xBE6C}, {0x3D99},
+    {0xBDCE}, {0x3E5E}, {0x3E35}, {0x3E70}, {0x3DAC}, {0x3E4C}, {0x3E38},
+    {0x3D3A}, {0x3E6B}, {0xBE01}, {0xBE50}, {0x3D02}, {0x3BB3}, {0xBD8E},
+    {0x3D6F}, {0x3E28}, {0x3C89}, {0x3E49}, {0x3D3C}, {0x3D6D}, {0x3E7E},
+    {0x3C9D}, {0x3E5A}, {0x3E29}, {0xBE5A}, {0x3DA2}, {0x3E56}, {0x3E18},
+    {0x3E37}, {0x3E19}, {0xBD89}, {0x3E5F}, {0xBAB3}, {0x3DAB}, {0xBE7F},
+    {0xBD2F}, {0x3E5F}, {0x3E46}, {0x3DD5}, {0xBD7B}, {0xBE28}, {0x3E23},
+    {0x3E3E}, {0xBE5B}, {0xBE5E}, {0xBD8C}, {0x3E62}, {0x3C9E}, {0x3DC9},
+    {0x3D47}, {0xBE24}, {0x3DC1}, {0xBC65}, {0xBD23}, {0x3C28}, {0xBE5F},
+    {0xBD7C}, {0xBC29}, {0xBE37}, {0xBE7F}, {0x3E76}, {0xBD16}, {0x3D8A},
+    {0xBDFC}, {0xBC85}, {0xBE31}, {0xBE3B}, {0x3E76}, {0xBE51}, {0xBD66},
+    {0xBE60}, {0x3D92}, {0xBE4F}, {0xBE51}, {0x3DCC}, {0x3DBF}, {0x3DBA},
+    {0xBE7B}, {0x3E0D}, {0x3E24}, {0xBE35}, {0xBE32}, {0xBE37}, {0x3E5B},
+    {0xBE1D}, {0xBE25}, {0x3E79}, {0x3E0B}, {0x3E6F}, {0x3E25}, {0x3DC6},
+    {0xBE70}, {0x3DCF}, {0x3DD6}, {0x3D94}, {0xBE76}, {0x3D3B}, {0x3E60},
+    {0xBD85}, {0x3D19}, {0xBD83}, {0xBC0E}, {0xBE2D}, {0xBB9B}, {0x3DB3},
+    {0x3E13}, {0x3E62}, {0x3E54}, {0xBCCE}, {0xBE23}, {0x3C20}, {0x3E65},
+    {0x3DB7}, {0xBE80}, {0xBDFE}, {0x3E43}, {0x3DCA}, {0x3CCA}, {0xBD18},
+    {0x3DE0}, {0xBD4E}, {0x3D52}, {0xBE5D}, {0xBE73}, {0xBC6C}, {0xBE65},
+    {0xBE37}, {0x3E0E}, {0x3D78}, {0x3E1D}, {0x3E00}, {0x3E49}, {0x3C0C},
+    {0xBB01}, {0x3E0C}, {0x3CCA}, {0xBE75}, {0x3E47}, {0x3E20}, {0x3E36},
+    {0xBE51}, {0x3E24}, {0xBE13}, {0x3DF8}, {0x3E2E}, {0x3D2A}, {0xBE31},
+    {0x3E09}, {0xBE37}, {0x3DC8}, {0xBDDB}, {0xBD28}, {0x3E54}, {0x3D02},
+    {0xBE4C}, {0x3E4C}, {0x3DA1}, {0xBE68}, {0x3E6B}, {0x3E3E}, {0x3E28},
+    {0x3E08}, {0xBDBA}, {0x3E7F}, {0x3CF9}, {0xBE19}, {0xBE51}, {0xBD84},
+    {0xBDC0}, {0xBDAB}, {0x3E22}, {0x3DFF}, {0xBDC2}, {0xBB41}, {0x3DEE},
+    {0xBE2A}, {0x3E65}, {0x3E5E}, {0xBE11}, {0x3E25}, {0x3E7D}, {0xBDB8},
+    {0x3DA6}, {0x3DAD}, {0x3D4B}, {0x3E56}, {0xBE1F}, {0xBC17}, {0xBDA2},
+    {0x3DB9}, {0x3E0F}, {0xBD75}, {0x3D93}, {0xBCE6}, {0x3E04}, {0xBE6E},
+    {0x3E4C}, {0xBD94}, {0xBDC8}, {0xBDEE}, {0xBDFF}, {0xBE61}, {0x3D99},
+    {0x3CE1}, {0x3DFF}, {0x3D45}, {0xBD33}, {0xBCE8}, {0xBE59}, {0x3CBA},
+    {0x3DF4}, {0xBE2E}, {0x3DD5}, {0x3E48}, {0xBE79}, {0xBD11}, {0xBE35},
+    {0xBE29}, {0xBD6B}, {0xBD2E}, {0x3E80}, {0x3E4A}, {0xBE07}, {0xBE18},
+    {0x3DD0}, {0xBE20}, {0x3C3B}, {0x3D20}, {0x3E18}, {0xBE3A}, {0x3DF8},
+    {0x3E2D}, {0x3E69}, {0x3D92}, {0x3E58}, {0xBD9A}, {0x3C4A}, {0xBE2D},
+    {0xBE68}, {0xBE1D}, {0x3E7A}, {0xBDE0}, {0xBD77}, {0xBE0F}, {0xBE05},
+    {0xBE06}, {0xBE59}, {0x3E00}, {0x3E79}, {0x3DBB}, {0x3E33}, {0x3DDC},
+    {0xBDEA}, {0x3E69}, {0xBD94}, {0xBE50}, {0x3C9D}, {0x3CC5}, {0xBC56},
+    {0x3DE1}, {0x3E5A}, {0xBE26}, {0x3E6F}, {0xBDB0}, {0xBE49}, {0xBDCB},
+    {0xBE02}, {0xBE21}, {0xBE70}, {0x3E1C}, {0x3D58}, {0xBC83}, {0x3CE4},
+    {0xBE0E}, {0x3E6A}, {0xBD85}, {0xBE6F}, {0xBDC5}, {0x3D68}, {0xBE32},
+    {0xBE48}, {0x3E05}, {0x3DD3}, {0xBE61}, {0x3D2D}, {0xBE06}, {0xBDFC},
+    {0xBD09}, {0xBE69}, {0xBD06}, {0xBD99}, {0x3E3F}, {0x3D69}, {0xBE41},
+    {0x3BDF}, {0xBE14}, {0x3E26}, {0x3D9B}, {0x3DE6}, {0x3E49}, {0xBCEF},
+    {0x3C17}, {0x3D01}, {0xBE33}, {0x3D25}, {0xBDDE}, {0xBD2F}, {0x3E36},
+    {0x3E31}, {0xBE09}, {0x3E76}, {0x3E29}, {0x3C98}, {0xBE2F}, {0x3DC9},
+    {0xBE16}, {0xBD7C}, {0x3E6A}, {0xBDAD}, {0xBE79}, {0x3BB4}, {0x3E78},
+    {0x3D97}, {0xBD07}, {0x3D90}, {0xBDAF}, {0x3E0C}, {0x3D82}, {0xBE41},
+    {0x3E61}, {0x3D85}, {0x3DBE}, {0xBBAA}, {0xBC40}, {0x3DE3}, {0xBE3A},
+    {0x3E23}, {0xBDBC}, {0xBDAB}, {0xBDE3}, {0x3CA4}, {0x3DE8}, {0xBE2D},
+    {0x3DBC}, {0x3DEA}, {0x39A1}, {0x3BC5}, {0xBC9C}, {0x3E7E}, {0x3E07},
+    {0x3E4E}, {0x3D1A}, {0xBD88}, {0xBE79}, {0xBD51}, {0x3E56}, {0xBD23},
+    {0x3DC4}, {0x3E17}, {0x3DA4}, {0xBE0E}, {0x3DF4}, {0xBE1A}, {0xBD79},
+    {0x3CD6}, {0x3E23}, {0x3E43}, {0x3DFD}, {0xBD91}, {0xBE23}, {0x3D35},
+    {0x3E3F}, {0xBE59}, {0xBB74}, {0x3E43}, {0xBE59}, {0x3CFC}, {0xBE70},
+    {0x3E23}, {0x3E12}, {0x3BB1}, {0x3DCE}, {0x3E77}, {0xBE76}, {0xBBC3},
+    {0x3DE7}, {0xBE6E}, {0xBCCB}, {0x3E17}, {0xBD9E}, {0xBE4E}, {0x3D83},
+    {0xBE38}, {0x3E36}, {0xBE13}, {0xBE11}, {0x3E6B}, {0x3D40}, {0xBD23},
+    {0xBCC5}, {0xBE46}, {0xBD51}, {0xBDC9}, {0x3E58}, {0xBE56}, {0x3C17},
+    {0x3DA8}, {0x3D31}, {0x3E18}, {0x3C9B}, {0xBD10}, {0xBE1F}, {0xBE37},
+    {0xBE10}, {0xBD82}, {0xBDC1}, {0x3E6B}, {0x3E3A}, {0xBE36}, {0xBE57},
+    {0xBE1E}, {0x3E5E}, {0x3A0A}, {0xBE0F}, {0x3E24}, {0x3DBD}, {0x3DDA},
+    {0xBDAE}, {0xBD0D}, {0x3E3E}, {0x3DB5}, {0xBC35}, {0xBE45}, {0xBDD5},
+    {0x3E57}, {0xBE6E}, {0xBDA1}, {0x3DFB}, {0x3DEC}, {0x3E13}, {0xBE6A},
+    {0x3E69}, {0x3E03}, {0x3DFD}, {0xBDB1}, {0x3E64}, {0xBE2F}, {0x3E42},
+    {0xBDCA}, {0x3C2D}, {0xBD51}, {0x3E49}, {0x3C97}, {0xBE75}, {0xBE15},
+    {0xBE26}, {0xBD05}, {0xBE68}, {0x3CB9}, {0xBD9A}, {0x3DDB}, {0x3E4A},
+    {0xBE0B}, {0x3E2B}, {0xBE59}, {0x3E2C}, {0x3E4C}, {0x3DD4}, {0x3D69},
+    {0x3DC9}, {0xBE41}, {0xBDE6}, {0xBE15}, {0x3C87}, {0x3E53}, {0x3D64},
+    {0xBE24}, {0xBE7E}, {0x3D6E}, {0xBD81}, {0xBE14}, {0x3C6D}, {0xBDAA},
+    {0xBE2C}, {0x3E46}, {0xBDF4}, {0x3E6F}, {0x3D0A}, {0xBE6D}, {0x3CD5},
+    {0x3E41}, {0x3DA6}, {0x3E49}, {0x3E38}, {0xBD88}, {0x3E46}, {0xBE41},
+    {0xBE0C}, {0xBE5A}, {0xBE61}, {0x3DAB}, {0xBC54}, {0x3D1D}, {0x3E5B},
+    {0x3DCA}, {0xBE1A}, {0xBD96}, {0xBE6C}, {0xBE1C}, {0xBE50}, {0xBE6F},
+    {0xBE7E}, {0xBE71}, {0xBDA6}, {0xBCE5}, {0xBC9B}, {0xBDF7}, {0x3DD6},
+    {0xBE45}, {0xBD89}, {0xBD9F}, {0xBDBD}, {0xBD9E}, {0xBCB4}, {0x3D66},
+    {0xBDA4}, {0xBD4A}, {0xBE27}, {0xBE5F}, {0xBD5E}, {0xBE0F}, {0x3E08},
+    {0xBE5C}, {0xBD8E}, {0xBE28}, {0x3E45}, {0xBE48}, {0x3E0E}, {0x3E2C},
+    {0x3C0B}, {0x3DC2}, {0x3D6B}, {0xBC60}, {0xBDE7}, {0x3E2D}, {0x3E63},
+    {0xBD10}, {0xBB84}, {0x3E7E}, {0x3DD6}, {0x3CFB}, {0xBDAD}, {0xBE27},
+    {0x3DEA}, {0x3E0F}, {0x3E2D}, {0xBE22}, {0x3E80}, {0x3E15}, {0xBDE6},
+    {0xBD0C}, {0xBE55}, {0xBD1D}, {0x3D12}, {0x3DC8}, {0x3DA2}, {0xBDF3},
+    {0xBE0B}, {0xBE1A}, {0x3D75}, {0xBD7E}, {0x3E09}, {0xBCED}, {0xBE66},
+    {0x3E03}, {0x3E3C}, {0x3D6A}, {0x3E5E}, {0xBE43}, {0x3E06}, {0xBDE8},
+    {0xBE04}, {0x3E1C}, {0xBDA8}, {0x3E1B}, {0x3B61}, {0xBE1F}, {0xBCC2},
+    {0xBE24}, {0x3E54}, {0xBDCE}, {0x3E76}, {0x3E49}, {0xBD46}, {0x3E16},
+    {0x3D83}, {0x3E54}, {0x3E19}, {0x3E1D}, {0xBC49}, {0x3B8C}, {0xBE65},
+    {0xBCE1}, {0xBDD8}, {0x3E1F}, {0x3D82}, {0xBE74}, {0x3C95}, {0xBDC0},
+    {0xBE51}, {0xBE5C}, {0x3E20}, {0xBE7A}, {0xBE7D}, {0x3E61}, {0xBE3B},
+    {0xBE6E}, {0xBE4F}, {0xBDBA}, {0xBE23}, {0xBD51}, {0x3E09}, {0x3D8F},
+    {0x3C98}, {0xBBFD}, {0x3D54}, {0xBD90}, {0x3DF2}, {0xBE0B}, {0x3E01},
+    {0x3E10}, {0xBD16}, {0x3C69}, {0x3E04}, {0xBD90}, {0x3E41}, {0x3DA3},
+    {0xBD8F}, {0xBE63}, {0x3E3A}, {0xBE6B}, {0xBDD1}, {0xBE06}, {0x3DEF},
+    {0xBD85}, {0x3DF9}, {0xBCAB}, {0x3E18}, {0xBE53}, {0xBD70}, {0xBE5B},
+    {0xBE09}, {0x3CB0}, {0xBD9A}, {0xBE48}, {0xBE75}, {0x3C47}, {0xBD31},
+    {0x3D43}, {0x3E51}, {0x3E1A}, {0xBE60}, {0x3E0E}, {0xBE37}, {0x3E4F},
+    {0xBE40}, {0xBD25}, {0x3E1B}, {0x3DAA}, {0xBDD6}, {0x3E25}, {0xBD57},
+    {0x3E0B}, {0xBC0C}, {0xBE2C}, {0xBC72}, {0xBD01}, {0x3E17}, {0xBD8F},
+    {0xBE13}, {0x3E3E}, {0x3DAE}, {0xBE43}, {0xBC68}, {0x3E4F}, {0xBE1F},
+    {0x3D4F}, {0x3E55}, {0xBD4E}, {0xBE21}, {0x3DEC}, {0xBE43}, {0xBD31},
+    {0xBE50}, {0x3C9A}, {0x3E13}, {0xBE04}, {0x3D18}, {0xBB27}, {0x3DBA},
+    {0xBE36}, {0xBCEA}, {0xBD93}, {0xBD8C}, {0x3DEE}, {0x3BC9}, {0x3E50},
+    {0x3DB9}, {0xBE5D}, {0x3E1F}, {0x3D2C}, {0x3DA6}, {0xBE02}, {0x3E25},
+    {0xBE13}, {0xBE09}, {0x3E36}, {0x3E76}, {0xBDC6}, {0x3C9A}, {0xBD71},
+    {0xBCDA}, {0xBD85}, {0xBE41}, {0xBE00}, {0x3DD2}, {0xBD44}, {0xBD67},
+    {0xBE38}, {0x3E28}, {0xBD97}, {0xBD84}, {0xBE3E}, {0xBE40}, {0xBE4E},
+    {0xBCBD}, {0x3BCC}, {0xBD98}, {0xBD0C}, {0xBE3E}, {0x3E37}, {0xBE19},
+    {0x3E3B}, {0xBE19}, {0x3E21}, {0xBD84}, {0x3CDD}, {0xBE5E}, {0x3D8D},
+    {0xBE37}, {0x3E66}, {0xBD07}, {0xBDE4}, {0x3E0F}, {0x3E34}, {0xBE65},
+    {0xBD9F}, {0x3E49}, {0x3E75}, {0x3D7E}, {0x3E1E}, {0x3E07}, {0xBBE8},
+    {0xBDB2}, {0x3E30}, {0x3DAF}, {0xBDCB}, {0xBDCC}, {0xBE1B}, {0xBD8A},
+    {0x3E77}, {0x3E2B}, {0xBE2A}, {0x3D07}, {0xBE5D}, {0x3DD7}, {0xBE41},
+    {0x3DA6}, {0x3E58}, {0xBCFE}, {0xBCAC}, {0x3E19}, {0xBDD4}, {0x3E10},
+    {0x3DD9}, {0x3E40}, {0x3E42}, {0x3DC2}, {0xBE39}, {0x3E7B}, {0xBDCC},
+    {0x3E40}, {0x3E62}, {0x3DDC}, {0xBD4B}, {0x3E54}, {0xBE61}, {0xBD74},
+    {0x3D5C}, {0xBD85}, {0xBD99}, {0x3E00}, {0xBE7E}, {0x3CB8}, {0xBCAB},
+    {0x3CBA}, {0xBD4B}, {0x3DEB}, {0xBDCC}, {0x3E2F}, {0x3E56}, {0x3DBD},
+    {0x3D98}, {0x3E6D}, {0x3E57}, {0xBE31}, {0xBDF7}, {0xBCD4}, {0x3DD4},
+    {0x3E33}, {0xBD63}, {0x3E3E}, {0x3C55},
+};
+
+bf16_t bf16_mlp_b1[BF16_MLP_H1] = {
+    {0xBC43}, {0x3D96}, {0x3DC1}, {0xBDC6}, {0x3D85}, {0x3D95}, {0x3D99},
+    {0xB9D7}, {0x3D70}, {0x3BFC}, {0x3DBA}, {0xBD76}, {0x3D7C}, {0xBDF7},
+    {0x3D5D}, {0x3DB9}, {0xBCB3}, {0xBDCE}, {0xBD14}, {0xBD11}, {0xBDF1},
+    {0xBD7E}, {0xBB59}, {0x3DC3}, {0xBDBB}, {0xBC4C}, {0x3D49}, {0xBD00},
+    {0xBC47}, {0xBDE1}, {0xBC29}, {0xBD99},
+};
+
+/* layer 2: 32 x 32, row-major, one row per output */
+bf16_t bf16_mlp_w2[BF16_MLP_H2 * BF16_MLP_H1] = {
+    {0xBE8C}, {0x3E7F}, {0x3E81}, {0x3D9A}, {0x3D67}, {0xBE72}, {0x3E00},
+    {0x3E6F}, {0xBD46}, {0xBE5C}, {0x3E5D}, {0x3DD6}, {0x3E82}, {0xBE04},
+    {0x3BB2}, {0x3E42}, {0xBE29}, {0xBE24}, {0x3D09}, {0x3E6F}, {0x3E34},
+    {0x3DA0}, {0xBD47}, {0x3D8D}, {0xBE87}, {0xBD16}, {0xBE4E}, {0xBE96},
+    {0x3E93}, {0x3DB0}, {0xBE95}, {0xBE47}, {0x3E83}, {0xBE0C}, {0xBDEB},
+    {0xBD21}, {0xBDA3}, {0x3DAA}, {0xBE56}, {0x3E6D}, {0xBE55}, {0x3D5B},
+    {0xBE76}, {0x3D33}, {0x3E40}, {0x3E7C}, {0xBE21}, {0xBE82}, {0x3D07},
+    {0x3DB9}, {0xBD39}, {0xBD33}, {0x3DD3}, {0x3E9B}, {0x3D6D}, {0x3DC1},
+    {0x3DE1}, {0xBDC2}, {0x3980}, {0xBE6E}, {0xBD5B}, {0x3E53}, {0x3DDD},
+    {0x3E9B}, {0x3D16}, {0x3E80}, {0x3E27}, {0xBE30}, {0x3D6B}, {0x3BE9},
+    {0xBD51}, {0x3E89}, {0x3E8F}, {0xBD64}, {0x3E99}, {0xBE5A}, {0xBE66},
+    {0x3D4B}, {0x3E7F}, {0xBE40}, {0xBE6D}, {0xBD18}, {0xBE87}, {0xBE84},
+    {0x3D83}, {0xBE94}, {0x3DF8}, {0xBD1C}, {0xBD4C}, {0x3E9C}, {0x3E6C},
+    {0x3C85}, {0x3E54}, {0xBE5D}, {0xBE27}, {0xBE97}, {0x3E14}, {0x3E9C},
+    {0xBE3B}, {0xBE5F}, {0x3DD5}, {0xBCCE}, {0xBD80}, {0x3E90}, {0x3E29},
+    {0x3E9A}, {0xBE55}, {0x3DAB}, {0xBE93}, {0xBE4B}, {0x3DA6}, {0x3E14},
+    {0xBDB5}, {0x3E8E}, {0x3E52}, {0xBC1D}, {0x3D45}, {0x3E03}, {0x3E95},
+    {0xBE13}, {0xBD3F}, {0x3E91}, {0x3E60}, {0xBD81}, {0x3C34}, {0x3DCB},
+    {0x3E9A}, {0x3DDA}, {0xBE17}, {0x3DF6}, {0xBE79}, {0xBE94}, {0x3D44},
+    {0xBD90}, {0x3D68}, {0xBD1F}, {0xBDF1}, {0x3E52}, {0x3CCC}, {0x3E48},
+    {0x3E68}, {0x3E8F}, {0xBE7A}, {0xBE08}, {0xBDAD}, {0x3E9B}, {0xBE5F},
+    {0x3E6F}, {0x3E96}, {0xBDC7}, {0x3CAD}, {0xBE13}, {0xBB84}, {0xBE8F},
+    {0x3DE1}, {0xBE2D}, {0x3DA9}, {0x3E75}, {0xBE98}, {0x3E8D}, {0x3E2A},
+    {0x3DA7}, {0x3DA1}, {0x3E43}, {0x3E2D}, {0x3DA3}, {0xBE8B}, {0xBDB8},
+    {0x3E1C}, {0xBDDB}, {0x3E38}, {0xBE94}, {0xBDFD}, {0xBE43}, {0xBE7B},
+    {0xBDEC}, {0x3C4F}, {0xBE6B}, {0x3E95}, {0x3E2C}, {0x3E22}, {0xBE81},
+    {0x3E29}, {0x3DC0}, {0xBD5E}, {0xBE82}, {0xBD7B}, {0xBD48}, {0x3DDD},
+    {0xBD8A}, {0xBE34}, {0x3D8A}, {0xBE96}, {0x3E53}, {0x3E3D}, {0x3E53},
+    {0xBE8F}, {0x3E26}, {0xBE8A}, {0x3E6D}, {0xBE3E}, {0x3E67}, {0x3E96},
+    {0x3E92}, {0x3E00}, {0xBE18}, {0x3E7C}, {0x3DBD}, {0x3E96}, {0x3DB2},
+    {0x3E5C}, {0xBD19}, {0xBE73}, {0xBD1D}, {0xBE22}, {0xBDC2}, {0xBE1B},
+    {0x3CA5}, {0xBE76}, {0x3E65}, {0x3E8B}, {0xBE1F}, {0xBC73}, {0xBE69},
+    {0x3E82}, {0xBCAE}, {0xBE44}, {0x3D69}, {0x3E60}, {0xBE92}, {0xBE30},
+    {0x3E91}, {0x3D4C}, {0x3E35}, {0x3E8D}, {0x3DA6}, {0xBE1E}, {0x3E52},
+    {0xBCBB}, {0xBE46}, {0xBE83}, {0xBD9A}, {0xBDDB}, {0x3E2E}, {0xBE97},
+    {0x3E7A}, {0x3E2C}, {0x3D01}, {0x3E89}, {0xBE3A}, {0xBE54}, {0x3E86},
+    {0xBD90}, {0xBD10}, {0xBD0D}, {0x3E97}, {0xBDCF}, {0x3E94}, {0xBE6E},
+    {0xBE90}, {0xBE9B}, {0x3E12}, {0xBE0D}, {0xBCCF}, {0xBE50}, {0xBD2C},
+    {0x3D2A}, {0xBE82}, {0xBE7A}, {0xBD8A}, {0x3DE4}, {0x3AC7}, {0xBE28},
+    {0x3BC8}, {0xBD95}, {0x3E52}, {0x3C5E}, {0x3D6A}, {0xBDEB}, {0x3D02},
+    {0x3E61}, {0x3E67}, {0xBCFB}, {0x3C57}, {0x3E08}, {0x3E30}, {0x3E8D},
+    {0xBE46}, {0xBCA6}, {0xBDE8}, {0x3BEA}, {0x3CC6}, {0xBE92}, {0x3E97},
+    {0x3DFB}, {0x3DE6}, {0x3C03}, {0x3DE1}, {0xBDE1}, {0xBD84}, {0xBE60},
+    {0x3DD8}, {0x3E53}, {0x3E69}, {0x3E24}, {0xBD41}, {0xBC11}, {0xBE98},
+    {0x3E8B}, {0xBE98}, {0x3CF5}, {0xBE08}, {0xBCBD}, {0xBE31}, {0xBE10},
+    {0xBD95}, {0x3E8C}, {0xBD86}, {0x3E49}, {0xBE8E}, {0x3640}, {0x3DEF},
+    {0x3E9B}, {0xBDD8}, {0xBE8A}, {0xBC5A}, {0x3D5A}, {0x3E5C}, {0xBC97},
+    {0xBDE5}, {0x3E96}, {0xBE16}, {0x3E90}, {0x3DA0}, {0xBD63}, {0x3D1A},
+    {0x3E40}, {0x3DAF}, {0xBE3D}, {0x3E36}, {0xBD94}, {0xBD17}, {0xBDF0},
+    {0xBE5F}, {0x3E7E}, {0x3E6F}, {0xBDEF}, {0xBE91}, {0x3E76}, {0x3DE3},
+    {0xBE00}, {0xBE3D}, {0x3E82}, {0xBCE3}, {0xBE7C}, {0x3E97}, {0x3DEF},
+    {0x3E5B}, {0x3D79}, {0xBE4D}, {0xBE36}, {0xBD69}, {0x3E24}, {0x3E92},
+    {0x3E0A}, {0xBE35}, {0xBE54}, {0xBE40}, {0x3E7A}, {0xBE9A}, {0xBD83},
+    {0xBE00}, {0xBDDB}, {0xBDDC}, {0x3DFF}, {0x3E8A}, {0x3E1A}, {0xBE1A},
+    {0xBD91}, {0xBE80}, {0x3E60}, {0xBE78}, {0x3DA8}, {0xBDC0}, {0xBE46},
+    {0x3E57}, {0xBE43}, {0x3E04}, {0x3BD1}, {0x3E2D}, {0xBD4F}, {0xBE02},
+    {0x3DE9}, {0xBD87}, {0x3E15}, {0x3D28}, {0x3E74}, {0xBE33}, {0xBD32},
+    {0x3D6E}, {0x3E99}, {0xBDEE}, {0x3E7A}, {0x3E99}, {0x393E}, {0x3C64},
+    {0x3E69}, {0xBD3D}, {0xBCBF}, {0xBDC0}, {0x3AFB}, {0xBE0C}, {0xBD0D},
+    {0xBE83}, {0x3D0A}, {0xBE13}, {0x3C5B}, {0x3C3C}, {0x3E91}, {0xBDC0},
+    {0xBE8F}, {0xBDB7}, {0x3D2A}, {0xBE15}, {0x3E28}, {0xBE4D}, {0xBC0B},
+    {0x3DD3}, {0x3D9D}, {0xBE7B}, {0xBE92}, {0xBDD5}, {0x3E3B}, {0xBE90},
+    {0xBE8D}, {0x3E6D}, {0x3E5D}, {0xBDC3}, {0x3E21}, {0x3D5A}, {0x3E4D},
+    {0xBE3B}, {0x3E27}, {0x3D16}, {0x3CB1}, {0xBB01}, {0xBE1E}, {0xBE25},
+    {0xBE9C}, {0x3CFE}, {0xBD53}, {0x3E84}, {0xBD3C}, {0x3DEC}, {0x3E78},
+    {0xBE4A}, {0xBE6D}, {0x3DFC}, {0x3E36}, {0xBC7C}, {0xBD18}, {0x3E5F},
+    {0x3C19}, {0x3E9B}, {0x3E84}, {0x3E62}, {0xBE63}, {0x3E07}, {0xBE3A},
+    {0x3E21}, {0x3D83}, {0x3E4B}, {0xBE98}, {0x3E3C}, {0xBE4D}, {0xBE4C},
+    {0xBCC4}, {0xBE82}, {0x3D18}, {0xBDB4}, {0x3D5B}, {0x3BE8}, {0xBE31},
+    {0xBD69}, {0x3DE6}, {0xBD8A}, {0x3BE1}, {0x3E94}, {0x3DB7}, {0xBDE2},
+    {0x3E2E}, {0xBDDB}, {0xBE12}, {0xBDB4}, {0xBE83}, {0xBE1B}, {0xBB8F},
+    {0x3E9B}, {0x3E30}, {0x3DD2}, {0x3E15}, {0x3E85}, {0x3E73}, {0x3D63},
+    {0x3DE9}, {0xBD8A}, {0xBE1F}, {0x3DAB}, {0xBE2F}, {0x3E93}, {0xBD46},
+    {0x3C15}, {0x3E4A}, {0xBDB0}, {0x3E42}, {0x3E42}, {0xBE90}, {0x3E00},
+    {0xBE87}, {0x3E0F}, {0xBE97}, {0x3E5C}, {0xBDD4}, {0x3E05}, {0xBD35},
+    {0xBE67}, {0x3E8C}, {0xBE83}, {0x3E8F}, {0x3DCE}, {0x3D96}, {0xBCF0},
+    {0x3E0B}, {0x3E24}, {0xBD8A}, {0xBE03}, {0xBE11}, {0x3E3F}, {0x3E71},
+    {0xBE59}, {0xBE29}, {0x3E5A}, {0xBE3B}, {0x3E7F}, {0x3E22}, {0x3DBB},
+    {0xBE9C}, {0xBDB1}, {0x3E8A}, {0xBC82}, {0xBE83}, {0x3E0D}, {0x3D8F},
+    {0xBE07}, {0xBE0F}, {0xBD07}, {0x3D41}, {0x3D39}, {0xBE39}, {0x3E06},
+    {0x3E90}, {0x3E86}, {0x3E7C}, {0x3D83}, {0x3E59}, {0xBE1A}, {0xBD91},
+    {0xBDFC}, {0xBE9A}, {0xBE99}, {0xBDA0}, {0xBE90}, {0xBBB2}, {0xBE8F},
+    {0x3DCA}, {0xBE82}, {0xBE82}, {0x3D9A}, {0x3E60}, {0xBE1E}, {0xBE3A},
+    {0xBE8D}, {0x3DF2}, {0x3E53}, {0xBE01}, {0x3E66}, {0x3E81}, {0x3E2D},
+    {0xBD9F}, {0x3E8D}, {0x3DE8}, {0xBE8D}, {0xBD5F}, {0x3D2C}, {0xBE95},
+    {0x3E06}, {0x3D59}, {0x3E8E}, {0xBDAD}, {0xBE91}, {0xBE8A}, {0xBC12},
+    {0xBE50}, {0x3E8D}, {0xBE4B}, {0xBE1A}, {0x3DA4}, {0x3E49}, {0x3D9A},
+    {0xBDF3}, {0xBE57}, {0xBE83}, {0xBE04}, {0xBE07}, {0xBE5F}, {0xBD76},
+    {0x3E81}, {0x3E29}, {0x3DCA}, {0xBE81}, {0x3D26}, {0xBDFC}, {0xBD8C},
+    {0x3E09}, {0xBE03}, {0x3E75}, {0xBA4A}, {0xBE57}, {0x3E7B}, {0xBE2C},
+    {0xBDD6}, {0x3E0A}, {0xBE96}, {0xBE91}, {0x3D32}, {0x3E59}, {0x3E27},
+    {0x3E8C}, {0xBE6D}, {0xBE13}, {0x3E2D}, {0x3DA2}, {0xBD90}, {0x3E84},
+    {0xBE68}, {0x3B5C}, {0xBE65}, {0x3D1D}, {0x3E92}, {0x3E4B}, {0xBCCB},
+    {0xBE63}, {0xBDD6}, {0xBCD8}, {0x3D9F}, {0x3DE9}, {0x3E2A}, {0xBE0B},
+    {0xBE5D}, {0x3E66}, {0xBE9C}, {0x3E42}, {0x3D0F}, {0xBE91}, {0x3DF8},
+    {0x3C83}, {0x3D1D}, {0xBE83}, {0x3CA0}, {0x3E74}, {0xBE13}, {0x3D89},
+    {0xBE07}, {0x3CBC}, {0x3DA4}, {0x3E8E}, {0x3DB1}, {0x3E99}, {0x3DE2},
+    {0xBE0E}, {0x3E9D}, {0xBE08}, {0x3E94}, {0x3D0F}, {0x3E2D}, {0xBE96},
+    {0x3E35}, {0xBE17}, {0x3D2C}, {0x3DCD}, {0xBE9C}, {0x3E02}, {0x3BA9},
+    {0xBD2C}, {0xBE16}, {0x3E93}, {0xBD54}, {0xBC66}, {0xBDBD}, {0xBDDD},
+    {0xBE81}, {0xBE0D}, {0x3DD4}, {0xBDBD}, {0x3E55}, {0x3E9B}, {0xBE96},
+    {0x3E7C}, {0xBE5C}, {0xBD02}, {0xBE50}, {0x3E8D}, {0xBE92}, {0xBD71},
+    {0xBE22}, {0x3E8E}, {0xBE20}, {0xBD61}, {0xBBE9}, {0xBE0D}, {0xBE84},
+    {0xBE82}, {0xBC44}, {0x3DBC}, {0x3E13}, {0x3E66}, {0xBE8F}, {0x3DA2},
+    {0xBE7D}, {0xBE2D}, {0x3D76}, {0x3DEA}, {0x3E97}, {0xBE9C}, {0x3E01},
+    {0xBDC7}, {0xBE8A}, {0x3E51}, {0x3D38}, {0xBE97}, {0x3E95}, {0x3E8E},
+    {0x3BB2}, {0x3DFC}, {0xBE20}, {0x3D82}, {0xBE6E}, {0x3E82}, {0x3D67},
+    {0xBE27}, {0x3C8E}, {0x3BEB}, {0x3CEB}, {0xBD46}, {0xBE53}, {0xBE5C},
+    {0x3E49}, {0x3DEC}, {0xBDF3}, {0xBE7F}, {0x3CC8}, {0x3DE6}, {0xBCCC},
+    {0xBE5D}, {0x3DED}, {0xBE32}, {0xBE1E}, {0xBE77}, {0xBE84}, {0xBDE0},
+    {0x3E00}, {0x3E8F}, {0xBE88}, {0xBD35}, {0x3D7B}, {0xBE2C}, {0x3E9A},
+    {0xBE02}, {0xBE87}, {0xBE1F}, {0xBE8E}, {0xBE88}, {0x3E54}, {0x3DBA},
+    {0xBE6B}, {0x3DDE}, {0x3E82}, {0x3E9C}, {0x3DD1}, {0xBE06}, {0xBE30},
+    {0xBDAD}, {0xBE2D}, {0xBE5C}, {0xBCBF}, {0xBCB0}, {0x3DD2}, {0xBC22},
+    {0xBE41}, {0xBC14}, {0x3E87}, {0xBE3F}, {0x3C01}, {0xBDEF}, {0xBE39},
+    {0x3E62}, {0x3D51}, {0x3E3C}, {0xBE84}, {0x39DE}, {0xBE2B}, {0xBE78},
+    {0xBE14}, {0xBE77}, {0x3D97}, {0x3E12}, {0xBD7A}, {0x3DB2}, {0x3C70},
+    {0xBD85}, {0xBC4C}, {0x3BEB}, {0xBB70}, {0xBCA0}, {0x3D75}, {0x3E7F},
+    {0xBE60}, {0x3E4B}, {0xBE55}, {0x3D76}, {0xBE90}, {0xBD48}, {0xBD96},
+    {0xB8D9}, {0x3E60}, {0x3E2E}, {0xBE99}, {0xBE84}, {0xBD4E}, {0x3E86},
+    {0x3C8D}, {0xBE6E}, {0xBE10}, {0x3E09}, {0xBDC4}, {0xBD9E}, {0xBE01},
+    {0xBE3D}, {0x3E83}, {0x3D91}, {0x3C57}, {0xBE7B}, {0x3E46}, {0x3E29},
+    {0x3DE0}, {0x3E3E}, {0x3D12}, {0x3CF7}, {0x3E64}, {0xBD25}, {0xBE0E},
+    {0xBDA1}, {0xBE3A}, {0x3E57}, {0xBC8B}, {0xBE4E}, {0x3E89}, {0xBD35},
+    {0xBE63}, {0x3D94}, {0xBD7A}, {0x3E2A}, {0xBE82}, {0xBCA7}, {0xBE65},
+    {0xBE51}, {0xBE03}, {0x3B6B}, {0xBDCF}, {0x3E9C}, {0xBE64}, {0xBD86},
+    {0xBE12}, {0xBE9C}, {0x3D24}, {0xBE3B}, {0xBE4A}, {0xBE3D}, {0x3C6E},
+    {0x3E86}, {0x3E6F}, {0xBD19}, {0xBDEF}, {0x3D92}, {0x3E78}, {0xBE75},
+    {0xBE1D}, {0x3E5F}, {0xBE39}, {0xBE03}, {0x3C1D}, {0x3E76}, {0x3E09},
+    {0x3E3C}, {0x3D54}, {0x3E68}, {0xBE33}, {0x3E1A}, {0xBDD2}, {0x3E24},
+    {0x3E5E}, {0xBDD1}, {0x3E67}, {0xBDF7}, {0xBD12}, {0x3E36}, {0xBE06},
+    {0xBD7A}, {0xBE87}, {0xBE5F}, {0xBE8C}, {0xBDA0}, {0xBE93}, {0xBE94},
+    {0x3E31}, {0x3E81}, {0xBE18}, {0xBE87}, {0xBD19}, {0xBE48}, {0xBDA9},
+    {0x3E83}, {0x3E3F}, {0xBD90}, {0x3E6E}, {0xBE24}, {0xBE05}, {0x3DFA},
+    {0xBE97}, {0x3E6D}, {0x3DC1}, {0x3C85}, {0xBD38}, {0x3DFD}, {0x3E8E},
+    {0x3E90}, {0x3E15}, {0xBE84}, {0xBDCF}, {0xBE5E}, {0xBE0A}, {0x3C84},
+    {0x3E31}, {0x3E3C}, {0xBC79}, {0xBDBE}, {0xBE02}, {0x3E30}, {0x3CD3},
+    {0xBE47}, {0x3E49}, {0x3E42}, {0xBDE6}, {0x3E43}, {0xBE93}, {0xBE86},
+    {0xBE58}, {0xBE15}, {0xBD0A}, {0x3E52}, {0x3D23}, {0xBE8D}, {0xBD8C},
+    {0xBE4C}, {0x3D8E}, {0x3D51}, {0x3D93}, {0xBDC0}, {0x3D07}, {0xBE8C},
+    {0x3DBC}, {0xBD2E}, {0xBDFB}, {0x3E9C}, {0x3E87}, {0x3E41}, {0x3CA1},
+    {0xBE8D}, {0xBCB7}, {0xBE98}, {0xBDDE}, {0xBE70}, {0xBE2A}, {0xBE85},
+    {0x3D8B}, {0xBE2C}, {0x3E2D}, {0xBE3B}, {0xBE17}, {0xBE9B}, {0xBE2D},
+    {0xB81C}, {0xBE83}, {0x3E03}, {0xBD98}, {0x3E86}, {0xBE68}, {0xBE8B},
+    {0xBE89}, {0xBE78}, {0x3E35}, {0x3E04}, {0x3E19}, {0x3E6B}, {0xBE37},
+    {0xBE42}, {0x3E1C}, {0xBC54}, {0x3E61}, {0xBE9C}, {0x3DF1}, {0xBE1C},
+    {0xBD96}, {0xBE85},
+};
+
+bf16_t bf16_mlp_b2[BF16_MLP_H2] = {
+    {0xBDA0}, {0xBD9E}, {0x3D96}, {0xBDA0}, {0xBD0C}, {0x3D5E}, {0xBCEC},
+    {0x3D66}, {0xBD21}, {0xBB6F}, {0x3DEC}, {0xBDC8}, {0x3A77}, {0xBB99},
+    {0x3D60}, {0x3DD0}, {0xBDDC}, {0x3D07}, {0xBC12}, {0x3DC6}, {0x3BD6},
+    {0x3D94}, {0xBDF4}, {0x3D97}, {0xBD1B}, {0x3DD4}, {0xBD5E}, {0xBD3C},
+    {0x3D40}, {0xBDE8}, {0x3D45}, {0x3CF3},
+};
+
+/* layer 3: 10 x 32, row-major, one row per output */
+bf16_t bf16_mlp_w3[BF16_MLP_OUT * BF16_MLP_H2] = {
+    {0xBE9F}, {0xBDEC}, {0xBE05}, {0x3E90}, {0x3EAF}, {0xBE1A}, {0xBE87},
+    {0xBEBB}, {0x3E54}, {0xBDB0}, {0xBD2B}, {0xBE99}, {0xBE16}, {0xBE17},
+    {0xBE95}, {0x3EAA}, {0x3E2F}, {0x3E3F}, {0xBD26}, {0x3E9E}, {0x3C09},
+    {0x3EAB}, {0xBDC9}, {0xBE49}, {0x3D9F}, {0x3D70}, {0x3E7E}, {0x3E39},
+    {0xBDBC}, {0xBE42}, {0xBE81}, {0xBDF1}, {0x3EA0}, {0x3E7C}, {0xBD36},
+    {0x3E23}, {0x3E66}, {0x3D97}, {0x3E13}, {0xBDE4}, {0x3DE1}, {0xBDD5},
+    {0x3E2D}, {0x3DD6}, {0x3E82}, {0xBE95}, {0xBDE0}, {0x3E38}, {0xBE31},
+    {0x3E43}, {0xBD9E}, {0x3DD0}, {0xBE8E}, {0x3E1F}, {0x3D00}, {0x3EB0},
+    {0xBEB6}, {0x3E68}, {0x3EBB}, {0xBE7C}, {0x3EA6}, {0xBE21}, {0x3D02},
+    {0xBE41}, {0xBD34}, {0xBEA7}, {0x3E30}, {0xBD01}, {0x3E0C}, {0x3E0A},
+    {0x3DDA}, {0x3E6B}, {0x3EBE}, {0x3D16}, {0x3E7F}, {0xBD88}, {0xBE67},
+    {0x3E98}, {0x3E58}, {0x3E6D}, {0xBEA3}, {0x3D88}, {0xBE6E}, {0x3E40},
+    {0x3EA0}, {0xBEB9}, {0xBE88}, {0xBE56}, {0xBEA4}, {0x3E05}, {0xBE54},
+    {0xBEBF}, {0xBE85}, {0xBC71}, {0x3EBC}, {0x3E82}, {0x3DF1}, {0x3D89},
+    {0x3E93}, {0x3D25}, {0x3E16}, {0x3E65}, {0xBEAA}, {0x3E21}, {0xBD3C},
+    {0x3E6D}, {0x3E37}, {0xBDE4}, {0xBDD8}, {0x3E10}, {0x3E6D}, {0x3E1A},
+    {0xBE6A}, {0x3EBC}, {0xBDC7}, {0x3EB9}, {0xBEB2}, {0xBC37}, {0xBE12},
+    {0xBE89}, {0xBE9C}, {0x3B03}, {0xBCAA}, {0x3EA0}, {0x3EB6}, {0xBEA5},
+    {0x3E79}, {0xBD56}, {0xBE62}, {0x3C2B}, {0x3E94}, {0x3E2A}, {0x3CEF},
+    {0xBE89}, {0x3E34}, {0x3EA1}, {0x3E7B}, {0x3E27}, {0xBE08}, {0xBE5A},
+    {0x3EB3}, {0x3E96}, {0x3CEB}, {0xBD16}, {0xBE63}, {0x3E28}, {0xBDD0},
+    {0x3E6A}, {0xBE81}, {0xBEA8}, {0x3DBC}, {0xBD80}, {0x3E8F}, {0x3E6A},
+    {0xBE25}, {0x3E8B}, {0x3E46}, {0x3EB1}, {0x3E4F}, {0x3E65}, {0x3E8F},
+    {0xBE27}, {0x3CAD}, {0xBEBD}, {0xBDC7}, {0x3E7C}, {0x3E9D}, {0x3EB1},
+    {0xBCFB}, {0xBE24}, {0xBDC6}, {0x3E60}, {0xBE36}, {0x3E19}, {0xBE8B},
+    {0x3E46}, {0xBE84}, {0xBDBF}, {0xBDE2}, {0x3EA1}, {0x3E93}, {0xBE80},
+    {0xBE31}, {0x3D59}, {0xBDB3}, {0xBE3E}, {0xBCD4}, {0x3E94}, {0xBE91},
+    {0xBDBD}, {0x3DEA}, {0x3E96}, {0x3BB6}, {0xBE60}, {0x3C80}, {0xBE14},
+    {0x3E8F}, {0x3E28}, {0x3C8E}, {0x3E04}, {0xBE17}, {0xBD56}, {0xBD9F},
+    {0x3E59}, {0xBE60}, {0x3D8F}, {0x3E27}, {0x3EA8}, {0x3EC1}, {0x3E49},
+    {0xBDA0}, {0xBEAB}, {0x3CAA}, {0x3D81}, {0x3EB9}, {0x3EB4}, {0x3E15},
+    {0xBCEA}, {0x3DE7}, {0xBEB9}, {0xBC1D}, {0xBDE7}, {0x3E5E}, {0x3E9D},
+    {0x3CD3}, {0xBD86}, {0xBE8D}, {0xBE96}, {0xBE9B}, {0xBE8C}, {0x3E90},
+    {0x3E20}, {0x3E50}, {0x3EA5}, {0xBE0A}, {0x3E8E}, {0x3EC1}, {0x3EB6},
+    {0x3E80}, {0x3DAF}, {0xBE42}, {0xBE85}, {0xBC41}, {0x3E8A}, {0xBE87},
+    {0xBE1A}, {0xBE32}, {0x3B06}, {0xBE95}, {0x3D6D}, {0x3CF4}, {0x3E32},
+    {0xBDFD}, {0x3D98}, {0xBE11}, {0x3E21}, {0xBE9E}, {0x3DE0}, {0xBDE3},
+    {0x3E9F}, {0xBEA6}, {0xBEA1}, {0x3E9F}, {0x3D71}, {0x3D56}, {0xBE91},
+    {0x3E28}, {0x3EA2}, {0xBE74}, {0x3D96}, {0xBEB4}, {0xBEB4}, {0xBEBE},
+    {0x3E8C}, {0x3EBC}, {0xBEAE}, {0xBDE9}, {0xBE45}, {0x3E91}, {0xBE6F},
+    {0xBE2C}, {0x3DAA}, {0x3D98}, {0xBE74}, {0xBEBC}, {0xBB92}, {0xBDC8},
+    {0x3E85}, {0x3D73}, {0x3E48}, {0xBC42}, {0xBEB4}, {0x3E54}, {0xBEAB},
+    {0x3EB1}, {0x3CA7}, {0x3EBE}, {0xBE5F}, {0x3E2D}, {0xBEB0}, {0x3EB9},
+    {0x3E4D}, {0x3EA7}, {0x3E1B}, {0x3E14}, {0xBC9B}, {0xBD2D}, {0xBD6A},
+    {0xBC62}, {0x38C6}, {0xBE4B}, {0x3DD6}, {0xBEA2}, {0xBE76}, {0x3DCC},
+    {0xBD33}, {0x3D63}, {0x3D86}, {0xBE3C}, {0x3DEE},
+};
+
+bf16_t bf16_mlp_b3[BF16_MLP_OUT] = {
+    {0x3CAF}, {0xBDB6}, {0xBD4A}, {0x3D77}, {0x3BBF}, {0x3DF3}, {0xBDE1},
+    {0xBD9D}, {0xBDE0}, {0x3DAF},
+};
+
+/* BF16_MLP_BATCH input vectors in [0, 1) */
+bf16_t bf16_mlp_input[BF16_MLP_BATCH * BF16_MLP_IN] = {
+    {0x3F4C}, {0x3F71}, {0x3DDF}, {0x3ED6}, {0x3F56}, {0x3E51}, {0x3F6C},
+    {0x3F4B}, {0x3EB5}, {0x3F76}, {0x3F24}, {0x3F23}, {0x3F22}, {0x3F29},
+    {0x3F56}, {0x3EC4}, {0x3E45}, {0x3F38}, {0x3F37}, {0x3EA8}, {0x3E64},
+    {0x3F45}, {0x3F49}, {0x3D77}, {0x3ED2}, {0x3E72}, {0x3F11}, {0x3C9E},
+    {0x3F39}, {0x3E4E}, {0x3DCD}, {0x3F1F}, {0x3F4D}, {0x3DD4}, {0x3D41},
+    {0x3EDB}, {0x3ED9}, {0x3E29}, {0x3DE3}, {0x3E1E}, {0x3F5E}, {0x3E81},
+    {0x3F1E}, {0x3E81}, {0x3E11}, {0x3F53}, {0x3E81}, {0x3E78}, {0x3EFF},
+    {0x3E81}, {0x3DEC}, {0x3EC2}, {0x3EEF}, {0x3F63}, {0x3F50}, {0x3F23},
+    {0x3E70}, {0x3E7E}, {0x3ECC}, {0x3EB1}, {0x3F51}, {0x3EF5}, {0x3F5A},
+    {0x3F50}, {0x3E8F}, {0x3F48}, {0x3E5F}, {0x3F18}, {0x3F55}, {0x3E43},
+    {0x3D10}, {0x3E9C}, {0x3DC3}, {0x3F35}, {0x3EC7}, {0x3F57}, {0x3D2B},
+    {0x3EAB}, {0x3F50}, {0x3F30}, {0x3DD7}, {0x3E86}, {0x3F4B}, {0x3F45},
+    {0x3D95}, {0x3F29}, {0x3EC7}, {0x3F34}, {0x3E78}, {0x3F2C}, {0x3F71},
+    {0x3F39}, {0x3D68}, {0x3F4C}, {0x3F7A}, {0x3E18}, {0x3EDA}, {0x3F18},
+    {0x3D0B}, {0x3F71}, {0x3CA6}, {0x3EA4}, {0x3EC4}, {0x3DD3}, {0x3EF6},
+    {0x3E43}, {0x3F0C}, {0x3F2A}, {0x3F4E}, {0x3ED4}, {0x3F17}, {0x3D98},
+    {0x3E55}, {0x3F04}, {0x3ED1}, {0x3F29}, {0x3F34}, {0x3F28}, {0x3EDA},
+    {0x3F05}, {0x3F1D}, {0x3F77}, {0x3F2D}, {0x3F08}, {0x3E33}, {0x3ECE},
+    {0x3E1B}, {0x3E52}, {0x3F6E}, {0x3F19}, {0x3E66}, {0x3F08}, {0x3B54},
+    {0x3EB6}, {0x3EDB}, {0x3F64}, {0x3D82}, {0x3DAB}, {0x3F22}, {0x3EF0},
+    {0x3E28}, {0x3EB7}, {0x3DAE}, {0x3F24}, {0x3F42}, {0x3F7C}, {0x3EAB},
+    {0x3DB8}, {0x3DB6}, {0x3F28}, {0x3DEE}, {0x3F41}, {0x3DF7}, {0x3F3C},
+    {0x3EE0}, {0x3F2D}, {0x3E9B}, {0x3D39}, {0x3EDA}, {0x3EBF}, {0x3E17},
+    {0x3EB5}, {0x3D86}, {0x3ED4}, {0x3ED7}, {0x3E45}, {0x3F61}, {0x3F78},
+    {0x3C7A}, {0x3F4B}, {0x3D07}, {0x3ADE}, {0x3E9D}, {0x3F6D}, {0x3F5E},
+    {0x3DF2}, {0x3E32}, {0x3F72}, {0x3F33}, {0x3F6B}, {0x3F75}, {0x3F32},
+    {0x3EDC}, {0x3F31}, {0x3EA2}, {0x3EF1}, {0x3F15}, {0x3D9A}, {0x3F15},
+    {0x3EC5}, {0x3F45}, {0x3E3C}, {0x3E04}, {0x3F6C}, {0x3F3E}, {0x3ED0},
+    {0x3F10}, {0x3F13}, {0x3F6A}, {0x3F5E}, {0x3F7A}, {0x3E4B}, {0x3F6A},
+    {0x3F56}, {0x3F0C}, {0x3EE3}, {0x3EA0}, {0x3F5A}, {0x3F60}, {0x3F69},
+    {0x3ED6}, {0x3F1E}, {0x3F35}, {0x3F05}, {0x3F7E}, {0x3F77}, {0x3F3E},
+    {0x3EB5}, {0x3F40}, {0x3E0C}, {0x3EF0}, {0x3EB1}, {0x3EA8}, {0x3E38},
+    {0x3EB8}, {0x3F5D}, {0x3E7E}, {0x3F5A}, {0x3F15}, {0x3ED8}, {0x3C94},
+    {0x3E67}, {0x3F23}, {0x3E3C}, {0x3CAB}, {0x3EC8}, {0x3EB1}, {0x3F01},
+    {0x3EE8}, {0x3DFC}, {0x3F7F}, {0x3F48}, {0x3ED5}, {0x3E5E}, {0x3ED7},
+    {0x3D09}, {0x3F0A}, {0x3E3B}, {0x3F1E}, {0x3DF8}, {0x3EC4}, {0x3D5A},
+    {0x3F19}, {0x3F0D}, {0x3EA9}, {0x3DB4}, {0x3F6A}, {0x3F35}, {0x3E7A},
+    {0x3EAC}, {0x3EC1}, {0x3ED0}, {0x3F60}, {0x3F33}, {0x3F5F}, {0x3F45},
+    {0x3DBD}, {0x3CF9}, {0x3F45}, {0x3F0C}, {0x3CA5}, {0x3CF0}, {0x3F73},
+    {0x3F77}, {0x3F25}, {0x3F32}, {0x3F43}, {0x3E67}, {0x3F3A}, {0x3B85},
+    {0x3F36}, {0x3B8D}, {0x3F0F}, {0x3F34}, {0x3EB9}, {0x3EB6}, {0x3F60},
+    {0x3F72}, {0x3F56}, {0x3F32}, {0x3D96}, {0x3F72}, {0x3F5D}, {0x3F15},
+    {0x3EA8}, {0x3F19}, {0x3F2A}, {0x3E4E}, {0x3EF9}, {0x3E88}, {0x3EE3},
+    {0x3E4F}, {0x3F38}, {0x3EA8}, {0x3EFB}, {0x3F24}, {0x3F36}, {0x3EC1},
+    {0x3E5B}, {0x3EAB}, {0x3EC7}, {0x3F1A}, {0x3EB5}, {0x3DC8}, {0x3F54},
+    {0x3E96}, {0x3F6A}, {0x3E8F}, {0x3F07}, {0x3EEA}, {0x3E89}, {0x3F29},
+    {0x3F5D}, {0x3ECC}, {0x3F2A}, {0x3EBC}, {0x3EA4}, {0x3F50}, {0x3ED3},
+    {0x3F23}, {0x3E5D}, {0x3CEB}, {0x3EA1}, {0x3EA7}, {0x3F15}, {0x3ECA},
+    {0x3D96}, {0x3F47}, {0x3EB6}, {0x3F7A}, {0x3D5F}, {0x3E29}, {0x3E01},
+    {0x3E73}, {0x3EC8}, {0x3F2E}, {0x3F4D}, {0x3E76}, {0x3E37}, {0x3EB4},
+    {0x3F6E}, {0x3F7D}, {0x3C8C}, {0x3F1D}, {0x3F24}, {0x3EA9}, {0x3F10},
+    {0x3E02}, {0x3E8A}, {0x3F0D}, {0x3D74}, {0x3F2F}, {0x3E9A}, {0x3F4C},
+    {0x3C1C}, {0x3F37}, {0x3E90}, {0x3EC8}, {0x3EA2}, {0x3F4B}, {0x3F38},
+    {0x3E50}, {0x3E0D}, {0x3DDB}, {0x3F6D}, {0x3E16}, {0x3E90}, {0x3CD6},
+    {0x3ECC}, {0x3DA8}, {0x3E1A}, {0x3F0B}, {0x3E60}, {0x3DCF}, {0x3F3D},
+    {0x3E7A}, {0x3E64}, {0x3E48}, {0x3EF4}, {0x3EA8}, {0x3D5A}, {0x3F09},
+    {0x3F13}, {0x3F7A}, {0x3F71}, {0x3EEB}, {0x3F75}, {0x3F46}, {0x3EFC},
+    {0x3EF2}, {0x3F07}, {0x3C04}, {0x3F7A}, {0x3E33}, {0x3EF2}, {0x3EC2},
+    {0x3F1D}, {0x3EAE}, {0x3F0B}, {0x3F77}, {0x3F41}, {0x3F68}, {0x3F0F},
+    {0x3E9B}, {0x3F51}, {0x3E98}, {0x3F03}, {0x3F69}, {0x3F25}, {0x3F1E},
+    {0x3E9E}, {0x3EF1}, {0x3F1C}, {0x3F6E}, {0x3E6D}, {0x3F1F}, {0x3F16},
+    {0x3F64}, {0x3F79}, {0x3E8A}, {0x3F09}, {0x3D94}, {0x3F11}, {0x3F49},
+    {0x3E3F}, {0x3EC2}, {0x3EC9}, {0x3F4D}, {0x3EA3}, {0x3EA7}, {0x3F10},
+    {0x3F0E}, {0x3F3E}, {0x3F70}, {0x3F21}, {0x3F3E}, {0x3F4A}, {0x3F36},
+    {0x3E4E}, {0x3F26}, {0x3F6F}, {0x3E1B}, {0x3B19}, {0x3F37}, {0x3F59},
+    {0x3EA9}, {0x3F27}, {0x3F7B}, {0x3F69}, {0x3E34}, {0x3B24}, {0x3E0F},
+    {0x3E95}, {0x3ECB}, {0x3F68}, {0x3CD3}, {0x3F44}, {0x3F1A}, {0x3F49},
+    {0x3F6C}, {0x3E74}, {0x3E2E}, {0x3ED9}, {0x3F0B}, {0x3F57}, {0x3F23},
+    {0x3F5F}, {0x3ED7}, {0x3ED7}, {0x3F37}, {0x3E89}, {0x3F56}, {0x3E17},
+    {0x3E8D}, {0x3F0E}, {0x3F25}, {0x3E19}, {0x3C88}, {0x3F36}, {0x3F38},
+    {0x3F37}, {0x3F13}, {0x3EF8}, {0x3F10}, {0x3EB1}, {0x3F1E}, {0x3DFF},
+    {0x3ED0}, {0x3F54}, {0x3F01}, {0x3F11}, {0x3F00}, {0x3EBC}, {0x3F5F},
+    {0x3F10}, {0x3E6A}, {0x3EDB}, {0x3F4E}, {0x3EAC}, {0x3F0F}, {0x3F3F},
+    {0x3F52},
+};
@@ -0,0 +1,48 @@
+#include <stdint.h>
+
+#include "bf16.h"
+
+/* Lookup tables behind bf16_mant_mul().  Every entry is a constant
+ * expression, so the compiler fills them in and no multiply runs on the
+ * target.  Only the table selected by BF16_MUL_TABLE is built.
+ */
+
+#define COL4(f, a, b) f(a, b), f(a, (b) + 1), f(a, (b) + 2), f(a, (b) + 3)
+#define COL16(f, a, b) \
+    COL4(f, a, b), COL4(f, a, (b) + 4), COL4(f, a, (b) + 8), COL4(f, a, (b) + 12)
+#define COL128(f, a, b)                                                 \
+    COL16(f, a, b), COL16(f, a, (b) + 16), COL16(f, a, (b) + 32),       \
+        COL16(f, a, (b) + 48), COL16(f, a, (b) + 64),                   \
+        COL16(f, a, (b) + 80), COL16(f, a, (b) + 96), COL16(f, a, (b) + 112)
+
+#define ROW4(r, a) r(a), r((a) + 1), r((a) + 2), r((a) + 3)
+#define ROW16(r, a) \
+    ROW4(r, a), ROW4(r, (a) + 4), ROW4(r, (a) + 8), ROW4(r, (a) + 12)
+#define ROW128(r, a)                                                    \
+    ROW16(r, a), ROW16(r, (a) + 16), ROW16(r, (a) + 32),                \
+        ROW16(r, (a) + 48), ROW16(r, (a) + 64), ROW16(r, (a) + 80),     \
+        ROW16(r, (a) + 96), ROW16(r, (a) + 112)
+
+#if BF16_MUL_TABLE == 1
+/* nibble x nibble */
+#define NIB(a, b) ((a) * (b))
+#define NIB_ROW(a) {COL16(NIB, a, 0)}
+
+const uint8_t bf16_nib_mul_table[16][16] = {ROW16(NIB_ROW, 0)};
+#endif
+
+#if BF16_MUL_TABLE == 2
+/* 7-bit mantissa (hidden bit stripped) x nibble */
+#define MANT_NIB(a, b) ((a) * (b))
+#define MANT_NIB_ROW(a) {COL16(MANT_NIB, a, 0)}
+
+const uint16_t bf16_mant_nib_table[128][16] = {ROW128(MANT_NIB_ROW, 0)};
+#endif
+
+#if BF16_MUL_TABLE == 3
+/* full product, hidden bits included */
+#define MANT_MUL(a, b) (((a) | 0x80) * ((b) | 0x80))
+#define MANT_MUL_ROW(a) {COL128(MANT_MUL, a, 0)}
+
+const uint16_t bf16_mant_mul_table[128][128] = {ROW128(MANT_MUL_ROW, 0)};
+#endif
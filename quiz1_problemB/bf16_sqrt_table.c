@@ -0,0 +1,24 @@
+#include <stdint.h>
+
+#include "bf16.h"
+
+/* Interpolation nodes for bf16_sqrt() and bf16_rsqrt().  Node k sits at
+ * x_k = (128 + 8k) << 7 for k <= 16 and (128 + 8(k - 16)) << 8 above, so
+ * nodes 0..16 cover [2^14, 2^15) and 16..32 cover [2^15, 2^16).
+ */
+
+/* floor(sqrt(x_k) * 2^7) */
+const uint16_t bf16_sqrt_table[33] = {
+    16384, 16888, 17377, 17854, 18317, 18770, 19211, 19643, 20066,
+    20480, 20885, 21283, 21673, 22057, 22434, 22805, 23170, 23883,
+    24576, 25249, 25905, 26545, 27169, 27780, 28377, 28963, 29536,
+    30099, 30651, 31194, 31727, 32251, 32768,
+};
+
+/* ceil(2^22 / sqrt(x_k)) */
+const uint16_t bf16_rsqrt_table[33] = {
+    32768, 31790, 30894, 30070, 29309, 28603, 27945, 27331, 26755,
+    26215, 25706, 25225, 24771, 24340, 23931, 23542, 23171, 22479,
+    21846, 21263, 20725, 20225, 19760, 19326, 18919, 18537, 18177,
+    17837, 17516, 17211, 16922, 16647, 16384,
+};
@@ -0,0 +1,459 @@
+/* Exhaustive host-side check of the bf16 ops.
+ *
+ * Built natively (see "make verify"), not for the target.  Every one of
+ * the 2^32 (a, b) pairs is run through bf16_add/sub/mul/div and compared
+ * against the same operation done in float32 and rounded to bf16 with a
+ * defined rule:
+ *
+ *   rne  round to nearest, ties to even (the default, what the ops do)
+ *   rtz  round toward zero
+ *
+ * bf16 is the top half of a float32, so the operands convert exactly; see
+ * reference() for how the result is kept exact up to the final rounding.
+ * Denormals are handled by the FPU; the host must not flush them.
+ *
+ * The a values are dealt out in chunks to a pool of threads.  Mismatches
+ * are counted by operand class and by the kind of difference, with the
+ * first example of each kept for the report.  Any two NaNs match.
+ *
+ * The functions of bf16_math.h are checked on all 2^16 inputs against libm
+ * in double, rounded to nearest.  They are not correctly rounded, so the
+ * report gives how many results miss and by how many ulps at most; the
+ * check fails beyond BF16_MATH_MAX_ULP.
+ */
+
+#include <fenv.h>
+#include <math.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "bf16.h"
+#include "bf16_math.h"
+
+enum { OP_ADD, OP_SUB, OP_MUL, OP_DIV, NUM_OPS };
+enum { ROUND_RTZ, ROUND_RNE };
+enum { FN_EXP, FN_LOG, FN_SIGMOID, FN_TANH, FN_GELU, NUM_FNS };
+
+/* operand classes */
+enum { CLS_ZERO, CLS_DENORM, CLS_NORMAL, CLS_INF, CLS_NAN, NUM_CLS };
+
+/* kinds of mismatch, expected vs got */
+enum {
+    KIND_NAN,  /* exactly one of them is NaN */
+    KIND_INF,  /* exactly one of them is infinite, or infinities differ */
+    KIND_ZERO, /* one is zero, the other a non-zero finite */
+    KIND_SIGN, /* same magnitude, other sign */
+    KIND_ULP,  /* same sign, one unit apart */
+    KIND_OTHER,
+    NUM_KINDS,
+};
+
+static const char *const op_names[NUM_OPS] = {"add", "sub", "mul", "div"};
+static const char *const fn_names[NUM_FNS] = {"exp", "log", "sigmoid",
+                                              "tanh", "gelu"};
+static const char *const cls_names[NUM_CLS] = {"zero", "denorm", "normal",
+                                               "inf", "nan"};
+static const char *const kind_names[NUM_KINDS] = {
+    "NaN", "Inf", "zero vs non-zero", "sign", "1 ulp", "other",
+};
+
+typedef struct {
+    unsigned long long count;
+    uint16_t a, b, got, expect;
+} mismatch_t;
+
+typedef mismatch_t table_t[NUM_CLS][NUM_CLS][NUM_KINDS];
+
+/* a values per work item */
+#define VERIFY_CHUNK 256
+
+static int verify_op;
+static int verify_round;
+static atomic_uint verify_next;
+static pthread_mutex_t verify_lock = PTHREAD_MUTEX_INITIALIZER;
+static table_t verify_table;
+
+static inline int classify(uint16_t x)
+{
+    uint16_t exp = x & BF16_EXP_MASK, mant = x & BF16_MANT_MASK;
+
+    if (exp == BF16_EXP_MASK)
+        return mant ? CLS_NAN : CLS_INF;
+    if (!exp)
+        return mant ? CLS_DENORM : CLS_ZERO;
+    return CLS_NORMAL;
+}
+
+static inline float bf16_to_float(uint16_t x)
+{
+    uint32_t u = (uint32_t) x << 16;
+    float f;
+
+    memcpy(&f, &u, sizeof(f));
+    return f;
+}
+
+/* Reference result.  The op runs in double, rounded toward zero.  That is
+ * exact for mul and for add/sub of nearby operands; a quotient or a sum of
+ * far-apart values loses bits only far below bf16 precision and never
+ * lands on a bf16 halfway point.  The conversion to float32 is then
+ * rounded to odd (any bits lost become bit 0), so rounding that float to
+ * bf16 with either rule is exact.
+ */
+static inline uint16_t reference(uint16_t a, uint16_t b)
+{
+    double da = bf16_to_float(a), db = bf16_to_float(b), r;
+    float f;
+    uint32_t u;
+
+    switch (verify_op) {
+    case OP_ADD:
+        r = da + db;
+        break;
+    case OP_SUB:
+        r = da - db;
+        break;
+    case OP_MUL:
+        r = da * db;
+        break;
+    default:
+        r = da / db;
+        break;
+    }
+    f = (float) r;
+    memcpy(&u, &f, sizeof(u));
+
+    if ((u & 0x7F800000) == 0x7F800000 && (u & 0x007FFFFF))
+        return 0x7FC0;
+    if ((double) f != r)
+        u |= 1;
+    if (verify_round == ROUND_RNE)
+        u += 0x7FFF + (u >> 16 & 1);
+    return u >> 16;
+}
+
+static inline uint16_t run_op(uint16_t a, uint16_t b)
+{
+    bf16_t x = {.bits = a}, y = {.bits = b};
+
+    switch (verify_op) {
+    case OP_ADD:
+        return bf16_add(x, y).bits;
+    case OP_SUB:
+        return bf16_sub(x, y).bits;
+    case OP_MUL:
+        return bf16_mul(x, y).bits;
+    default:
+        return bf16_div(x, y).bits;
+    }
+}
+
+static int mismatch_kind(uint16_t got, uint16_t expect)
+{
+    int cg = classify(got), ce = classify(expect);
+
+    if ((cg == CLS_NAN) != (ce == CLS_NAN))
+        return KIND_NAN;
+    if (cg == CLS_INF || ce == CLS_INF)
+        return KIND_INF;
+    if ((cg == CLS_ZERO) != (ce == CLS_ZERO))
+        return KIND_ZERO;
+    if ((got ^ expect) == BF16_SIGN_MASK)
+        return KIND_SIGN;
+    if (!((got ^ expect) & BF16_SIGN_MASK) &&
+        (got - expect == 1 || expect - got == 1))
+        return KIND_ULP;
+    return KIND_OTHER;
+}
+
+static void *verify_worker(void *arg)
+{
+    table_t *local = calloc(1, sizeof(table_t));
+
+    (void) arg;
+    if (!local) {
+        perror("calloc");
+        exit(2);
+    }
+    fesetround(FE_TOWARDZERO);
+
+    for (;;) {
+        uint32_t first = atomic_fetch_add(&verify_next, VERIFY_CHUNK);
+        if (first >= 0x10000)
+            break;
+
+        for (uint32_t a = first; a < first + VERIFY_CHUNK; a++) {
+            for (uint32_t b = 0; b < 0x10000; b++) {
+                uint16_t got = run_op(a, b), expect = reference(a, b);
+
+                if (got == expect ||
+                    (classify(got) == CLS_NAN && classify(expect) == CLS_NAN))
+                    continue;
+
+                mismatch_t *m = &(*local)[classify(a)][classify(b)]
+                                         [mismatch_kind(got, expect)];
+                if (!m->count++) {
+                    m->a = a;
+                    m->b = b;
+                    m->got = got;
+                    m->expect = expect;
+                }
+            }
+        }
+    }
+
+    pthread_mutex_lock(&verify_lock);
+    for (int i = 0; i < NUM_CLS; i++)
+        for (int j = 0; j < NUM_CLS; j++)
+            for (int k = 0; k < NUM_KINDS; k++) {
+                mismatch_t *src = &(*local)[i][j][k];
+                mismatch_t *dst = &verify_table[i][j][k];
+                if (!src->count)
+                    continue;
+                if (!dst->count)
+                    *dst = *src;
+                else
+                    dst->count += src->count;
+            }
+    pthread_mutex_unlock(&verify_lock);
+
+    free(local);
+    return NULL;
+}
+
+/* Sweep one op on nthreads threads; returns the number of mismatches */
+static unsigned long long verify(int op, int nthreads)
+{
+    pthread_t *threads = calloc(nthreads, sizeof(pthread_t));
+    unsigned long long total = 0;
+
+    if (!threads) {
+        perror("calloc");
+        exit(2);
+    }
+    verify_op = op;
+    atomic_store(&verify_next, 0);
+    memset(verify_table, 0, sizeof(verify_table));
+
+    for (int t = 0; t < nthreads; t++) {
+        if (pthread_create(&threads[t], NULL, verify_worker, NULL)) {
+            perror("pthread_create");
+            exit(2);
+        }
+    }
+    for (int t = 0; t < nthreads; t++)
+        pthread_join(threads[t], NULL);
+    free(threads);
+
+    for (int i = 0; i < NUM_CLS; i++)
+        for (int j = 0; j < NUM_CLS; j++)
+            for (int k = 0; k < NUM_KINDS; k++) {
+                mismatch_t *m = &verify_table[i][j][k];
+                if (!m->count)
+                    continue;
+                total += m->count;
+                printf("  %-6s %-6s %-16s %12llu  e.g. %04x %s %04x = %04x, "
+                       "expected %04x\n",
+                       cls_names[i], cls_names[j], kind_names[k], m->count,
+                       m->a, op_names[op], m->b, m->got, m->expect);
+            }
+    return total;
+}
+
+/* ============= Unary functions ============= */
+
+/* Round a double to bf16, to nearest with ties to even */
+static uint16_t round_double(double r)
+{
+    uint16_t sign = signbit(r) ? 0x8000 : 0;
+    int e;
+
+    if (isnan(r))
+        return 0x7FC0;
+    r = fabs(r);
+    if (isinf(r))
+        return sign | 0x7F80;
+    if (r == 0)
+        return sign;
+
+    /* r = q * 2^(exp - 134) with exp the biased exponent of r, at least 1
+     * so that a denormal gets the fixed scale
+     */
+    frexp(r, &e);
+    int exp = e + 126 < 1 ? 1 : e + 126;
+    double q = ldexp(r, 134 - exp), fl = floor(q);
+    uint32_t m = (uint32_t) fl;
+
+    if (q - fl > 0.5 || (q - fl == 0.5 && (m & 1)))
+        m++;
+    uint32_t bits = ((exp - 1) << 7) + m;
+    return sign | (bits > 0x7F80 ? 0x7F80 : bits);
+}
+
+static double fn_reference(int fn, double x)
+{
+    switch (fn) {
+    case FN_EXP:
+        return exp(x);
+    case FN_LOG:
+        return log(x);
+    case FN_SIGMOID:
+        return 1 / (1 + exp(-x));
+    case FN_TANH:
+        return tanh(x);
+    default:
+        /* x * sigmoid(2 z) == 0.5 x (1 + tanh(z)), without the cancellation */
+        if (isinf(x))
+            return x > 0 ? x : -0.0;
+        return x / (1 + exp(-2 * sqrt(2 / M_PI) * (x + 0.044715 * x * x * x)));
+    }
+}
+
+static uint16_t run_fn(int fn, uint16_t a)
+{
+    bf16_t x = {.bits = a};
+
+    switch (fn) {
+    case FN_EXP:
+        return bf16_exp(x).bits;
+    case FN_LOG:
+        return bf16_log(x).bits;
+    case FN_SIGMOID:
+        return bf16_sigmoid(x).bits;
+    case FN_TANH:
+        return bf16_tanh(x).bits;
+    default:
+        return bf16_gelu(x).bits;
+    }
+}
+
+/* Value order: -0 and +0 both 0x8000, like bf16x2_key() */
+static inline int32_t order_key(uint16_t x)
+{
+    return x & 0x8000 ? 0x8000 - (x & 0x7FFF) : 0x8000 + x;
+}
+
+/* Sweep one function; returns the number of results off by more than
+ * BF16_MATH_MAX_ULP, or of another kind (NaN, sign of a zero)
+ */
+static unsigned long long verify_fn(int fn)
+{
+    unsigned long long missed = 0, failed = 0;
+    uint32_t worst = 0;
+    uint16_t worst_a = 0, worst_got = 0, worst_expect = 0;
+
+    for (uint32_t a = 0; a < 0x10000; a++) {
+        uint16_t got = run_fn(fn, a);
+        uint16_t expect = round_double(fn_reference(fn, bf16_to_float(a)));
+
+        if (got == expect ||
+            (classify(got) == CLS_NAN && classify(expect) == CLS_NAN))
+            continue;
+
+        int32_t d = order_key(got) - order_key(expect);
+        uint32_t ulps = d < 0 ? -d : d;
+
+        if (classify(got) == CLS_NAN || classify(expect) == CLS_NAN ||
+            !ulps)
+            ulps = UINT32_MAX;
+        missed++;
+        if (ulps > BF16_MATH_MAX_ULP)
+            failed++;
+        if (ulps > worst) {
+            worst = ulps;
+            worst_a = a;
+            worst_got = got;
+            worst_expect = expect;
+        }
+    }
+
+    if (missed)
+        printf("  %llu not correctly rounded (%.2f%%), worst %s(%04x) = %04x, "
+               "expected %04x\n",
+               missed, 100.0 * missed / 0x10000, fn_names[fn], worst_a,
+               worst_got, worst_expect);
+    return failed;
+}
+
+static void usage(const char *prog)
+{
+    fprintf(stderr,
+            "usage: %s [-j threads] [-r rne|rtz] "
+            "[add|sub|mul|div|exp|log|sigmoid|tanh|gelu ...]\n",
+            prog);
+    exit(2);
+}
+
+int main(int argc, char **argv)
+{
+    int nthreads = (int) sysconf(_SC_NPROCESSORS_ONLN);
+    int ops[NUM_OPS + NUM_FNS], nops = 0;
+    bool selected[NUM_OPS + NUM_FNS] = {false};
+    unsigned long long failed = 0;
+    int opt;
+
+    verify_round = ROUND_RNE;
+    while ((opt = getopt(argc, argv, "j:r:")) != -1) {
+        switch (opt) {
+        case 'j':
+            nthreads = atoi(optarg);
+            break;
+        case 'r':
+            if (!strcmp(optarg, "rtz"))
+                verify_round = ROUND_RTZ;
+            else if (!strcmp(optarg, "rne"))
+                verify_round = ROUND_RNE;
+            else
+                usage(argv[0]);
+            break;
+        default:
+            usage(argv[0]);
+        }
+    }
+    if (nthreads < 1)
+        nthreads = 1;
+
+    /* ops[] holds op, or NUM_OPS + fn for a function; a name given
+     * twice runs once, so ops[] cannot overflow
+     */
+    for (int i = optind; i < argc; i++) {
+        int op;
+        for (op = 0; op < NUM_OPS + NUM_FNS; op++)
+            if (!strcmp(argv[i], op < NUM_OPS ? op_names[op]
+                                              : fn_names[op - NUM_OPS]))
+                break;
+        if (op == NUM_OPS + NUM_FNS)
+            usage(argv[0]);
+        if (!selected[op]) {
+            selected[op] = true;
+            ops[nops++] = op;
+        }
+    }
+    if (!nops)
+        for (nops = 0; nops < NUM_OPS + NUM_FNS; nops++)
+            ops[nops] = nops;
+
+    printf("bf16 exhaustive verify: %d threads, reference float32 %s\n",
+           nthreads, verify_round == ROUND_RTZ ? "round-toward-zero"
+                                               : "round-to-nearest-even");
+    for (int i = 0; i < nops; i++) {
+        unsigned long long n;
+        if (ops[i] >= NUM_OPS) {
+            printf("bf16_%s: 2^16 inputs\n", fn_names[ops[i] - NUM_OPS]);
+            n = verify_fn(ops[i] - NUM_OPS);
+        } else {
+            printf("bf16_%s: 2^32 pairs\n", op_names[ops[i]]);
+            n = verify(ops[i], nthreads);
+        }
+        if (n)
+            printf("  %llu mismatches\n", n);
+        else
+            printf("  PASSED\n");
+        failed += n;
+    }
+    return failed ? 1 : 0;
+}
@@ -0,0 +1,220 @@
+#ifndef BF16X2_H
+#define BF16X2_H
+
+#include <stdint.h>
+
+#include "bf16.h"
+
+/* ============= Packed pairs =============
+ *
+ * Two bf16 values in one RV32 word, element 0 in the low lane and element 1
+ * in the high lane, the order they have in memory.  The sign, exponent and
+ * mantissa fields of both lanes are isolated with one mask each and worked
+ * on together, with lane sums kept small enough that no carry or borrow
+ * crosses bit 16.  A lane is handled on its own only where the lanes
+ * really differ: the alignment and normalization shifts of an add, and
+ * an operand that is not a normal number, which goes to the scalar op.
+ * Every result is bit-identical to the scalar op applied lane by lane.
+ */
+
+typedef struct {
+    uint32_t bits;
+} bf16x2_t;
+
+#define BF16X2_SIGN_MASK 0x80008000U
+#define BF16X2_EXP_MASK 0x7F807F80U
+#define BF16X2_MANT_MASK 0x007F007FU
+#define BF16X2_LANE_LSB 0x00010001U
+
+static inline bf16x2_t bf16x2_pack(bf16_t lo, bf16_t hi)
+{
+    return (bf16x2_t) {.bits = lo.bits | (uint32_t) hi.bits << 16};
+}
+
+static inline bf16_t bf16x2_lo(bf16x2_t x)
+{
+    return (bf16_t) {.bits = x.bits};
+}
+
+static inline bf16_t bf16x2_hi(bf16x2_t x)
+{
+    return (bf16_t) {.bits = x.bits >> 16};
+}
+
+/* p[0] and p[1] of a bf16 array: one word access when p is 4-byte aligned,
+ * two half-word accesses otherwise.
+ */
+typedef uint32_t bf16x2_word_t __attribute__((__may_alias__));
+
+static inline bf16x2_t bf16x2_load(const bf16_t *p)
+{
+    if ((uintptr_t) p & 2)
+        return bf16x2_pack(p[0], p[1]);
+    return (bf16x2_t) {.bits = *(const bf16x2_word_t *) p};
+}
+
+static inline void bf16x2_store(bf16_t *p, bf16x2_t x)
+{
+    if ((uintptr_t) p & 2) {
+        p[0] = bf16x2_lo(x);
+        p[1] = bf16x2_hi(x);
+        return;
+    }
+    *(bf16x2_word_t *) p = x.bits;
+}
+
+/* Lane helpers.  A "flag" has bit 15 of a lane set for true; a "mask" has
+ * the whole lane set.
+ */
+static inline uint32_t bf16x2_fill(uint32_t flag)
+{
+    return flag | (flag - (flag >> 15));
+}
+
+/* Flag the lanes that hold a normal number (biased exponent 1..254) */
+static inline uint32_t bf16x2_normal_flag(bf16x2_t x)
+{
+    uint32_t exp = x.bits & BF16X2_EXP_MASK;
+
+    return ((exp | BF16X2_SIGN_MASK) - 0x00800080U) &
+           ~(exp + 0x00800080U) & BF16X2_SIGN_MASK;
+}
+
+static inline uint32_t bf16x2_nan_flag(bf16x2_t x)
+{
+    return ((x.bits & 0x7FFF7FFFU) + BF16X2_MANT_MASK) & BF16X2_SIGN_MASK;
+}
+
+static inline bf16x2_t bf16x2_neg(bf16x2_t x)
+{
+    return (bf16x2_t) {.bits = x.bits ^ BF16X2_SIGN_MASK};
+}
+
+static inline bf16x2_t bf16x2_abs(bf16x2_t x)
+{
+    return (bf16x2_t) {.bits = x.bits & ~BF16X2_SIGN_MASK};
+}
+
+/* The fields are unpacked for both lanes at once; the aligned sum itself
+ * needs a per-lane shift, so each lane then goes through the scalar core.
+ */
+static inline bf16x2_t bf16x2_add(bf16x2_t a, bf16x2_t b)
+{
+    uint32_t normal = bf16x2_normal_flag(a) & bf16x2_normal_flag(b);
+    uint32_t sign_a = (a.bits >> 15) & BF16X2_LANE_LSB;
+    uint32_t sign_b = (b.bits >> 15) & BF16X2_LANE_LSB;
+    uint32_t exp_a = (a.bits >> 7) & 0x00FF00FFU;
+    uint32_t exp_b = (b.bits >> 7) & 0x00FF00FFU;
+    uint32_t mant_a = (a.bits & BF16X2_MANT_MASK) | 0x00800080U;
+    uint32_t mant_b = (b.bits & BF16X2_MANT_MASK) | 0x00800080U;
+    bf16_t lo, hi;
+
+    if (normal & 0x8000)
+        lo = bf16_add_unpacked(sign_a & 1, exp_a & 0xFF, mant_a & 0xFF,
+                               sign_b & 1, exp_b & 0xFF, mant_b & 0xFF);
+    else
+        lo = bf16_add(bf16x2_lo(a), bf16x2_lo(b));
+    if (normal >> 31)
+        hi = bf16_add_unpacked(sign_a >> 16, exp_a >> 16, mant_a >> 16,
+                               sign_b >> 16, exp_b >> 16, mant_b >> 16);
+    else
+        hi = bf16_add(bf16x2_hi(a), bf16x2_hi(b));
+    return bf16x2_pack(lo, hi);
+}
+
+static inline bf16x2_t bf16x2_sub(bf16x2_t a, bf16x2_t b)
+{
+    return bf16x2_add(a, bf16x2_neg(b));
+}
+
+/* Only the two mantissa products are computed per lane.  Both fit a lane
+ * (2^14 <= p < 2^16), so normalization, rounding and the exponent are done
+ * for the pair at once.  A lane whose operands are not both normal, or
+ * whose product leaves the normal range, is redone by bf16_mul.
+ */
+static inline bf16x2_t bf16x2_mul(bf16x2_t a, bf16x2_t b)
+{
+    uint32_t sign = (a.bits ^ b.bits) & BF16X2_SIGN_MASK;
+    uint32_t exp = ((a.bits >> 7) & 0x00FF00FFU) + ((b.bits >> 7) & 0x00FF00FFU);
+    uint32_t mant_a = (a.bits & BF16X2_MANT_MASK) | 0x00800080U;
+    uint32_t mant_b = (b.bits & BF16X2_MANT_MASK) | 0x00800080U;
+    uint32_t p = bf16_mant_mul(mant_a & 0xFF, mant_b & 0xFF) |
+                 bf16_mant_mul(mant_a >> 16, mant_b >> 16) << 16;
+
+    /* double the lanes below 2^15, so every lane has its top bit in 15 */
+    uint32_t top = p & BF16X2_SIGN_MASK;
+    uint32_t keep = bf16x2_fill(top);
+    p = (p & keep) | ((p & ~keep) << 1);
+    exp += top >> 15;
+
+    /* round to 8 bits, ties to even; bit 0 is folded into the sticky
+     * bits first so that the increment cannot carry out of the lane
+     */
+    p = ((p >> 1) & 0x7FFF7FFFU) | (p & BF16X2_LANE_LSB);
+    p += 0x003F003FU + ((p >> 7) & BF16X2_LANE_LSB);
+    p = (p >> 7) & 0x01FF01FFU;
+
+    /* exp holds exp_a + exp_b + carry; the biased result exponent
+     * exp - 127 must be 1..254, i.e. 128 <= exp < 382
+     */
+    uint32_t ok = bf16x2_normal_flag(a) & bf16x2_normal_flag(b) &
+                  (exp + 0x7F807F80U) & ~(exp + 0x7E827E82U);
+    uint32_t ok_mask = bf16x2_fill(ok);
+    exp = (exp & ok_mask) | (0x00800080U & ~ok_mask);
+
+    /* a rounding carry into 0x100 steps the exponent up, to Inf at 254 */
+    bf16x2_t r = {.bits = sign | (((exp - 0x00800080U) << 7) + p)};
+
+    if (ok != BF16X2_SIGN_MASK) {
+        if (!(ok & 0x8000))
+            r.bits = (r.bits & 0xFFFF0000U) |
+                     bf16_mul(bf16x2_lo(a), bf16x2_lo(b)).bits;
+        if (!(ok >> 31))
+            r.bits = (r.bits & 0xFFFFU) |
+                     (uint32_t) bf16_mul(bf16x2_hi(a), bf16x2_hi(b)).bits << 16;
+    }
+    return r;
+}
+
+/* bf16_key() of each lane: negative values count down from 0x7FFF, +0
+ * and -0 both become 0x8000, positive values count up.
+ */
+static inline uint32_t bf16x2_key(bf16x2_t x)
+{
+    uint32_t mag = x.bits & 0x7FFF7FFFU;
+    uint32_t neg = x.bits & (mag + 0x7FFF7FFFU) & BF16X2_SIGN_MASK;
+
+    return (mag | BF16X2_SIGN_MASK) ^ bf16x2_fill(neg);
+}
+
+/* Comparisons give a mask, 0xFFFF in each lane where the relation holds.
+ * They follow bf16_eq / bf16_lt / bf16_le: false when a lane is NaN.
+ */
+static inline uint32_t bf16x2_eq(bf16x2_t a, bf16x2_t b)
+{
+    uint32_t d = bf16x2_key(a) ^ bf16x2_key(b);
+    uint32_t zero = ~(((d & 0x7FFF7FFFU) + 0x7FFF7FFFU) | d) & BF16X2_SIGN_MASK;
+
+    return bf16x2_fill(zero & ~(bf16x2_nan_flag(a) | bf16x2_nan_flag(b)));
+}
+
+static inline uint32_t bf16x2_lt(bf16x2_t a, bf16x2_t b)
+{
+    uint32_t ka = bf16x2_key(a), kb = bf16x2_key(b);
+
+    /* lane-wise ka - kb: bit 15 of diff is that of the full subtraction,
+     * the borrow out of bit 15 says ka < kb
+     */
+    uint32_t diff = ((ka | BF16X2_SIGN_MASK) - (kb & ~BF16X2_SIGN_MASK)) ^
+                    ((ka ^ ~kb) & BF16X2_SIGN_MASK);
+    uint32_t borrow = ((~ka & kb) | (~(ka ^ kb) & diff)) & BF16X2_SIGN_MASK;
+
+    return bf16x2_fill(borrow & ~(bf16x2_nan_flag(a) | bf16x2_nan_flag(b)));
+}
+
+static inline uint32_t bf16x2_le(bf16x2_t a, bf16x2_t b)
+{
+    return bf16x2_lt(a, b) | bf16x2_eq(a, b);
+}
+
+#endif
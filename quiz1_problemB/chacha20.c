@@ -0,0 +1,178 @@
+#include <stddef.h>
+#include <stdint.h>
+
+#include "chacha20.h"
+
+/* "expand 32-byte k" */
+static const uint32_t chacha20_sigma[4] = {0x61707865, 0x3320646e, 0x79622d32,
+                                           0x6b206574};
+
+static uint32_t load32_le(const uint8_t *p)
+{
+    return p[0] | (uint32_t) p[1] << 8 | (uint32_t) p[2] << 16 |
+           (uint32_t) p[3] << 24;
+}
+
+void chacha20_init(chacha20_ctx_t *ctx,
+                   const uint8_t key[32],
+                   const uint8_t nonce[12],
+                   uint32_t ctr)
+{
+    for (int i = 0; i < 4; i++)
+        ctx->state[i] = chacha20_sigma[i];
+    for (int i = 0; i < 8; i++)
+        ctx->state[4 + i] = load32_le(key + 4 * i);
+    ctx->state[12] = ctr;
+    for (int i = 0; i < 3; i++)
+        ctx->state[13 + i] = load32_le(nonce + 4 * i);
+    ctx->used = 64;
+}
+
+/* The HChaCha20 subkey as state words; the key is wiped off the stack */
+static void hchacha20_words(uint32_t subkey[8],
+                            const uint8_t key[32],
+                            const uint8_t nonce[16])
+{
+    uint32_t state[16];
+
+    for (int i = 0; i < 4; i++)
+        state[i] = chacha20_sigma[i];
+    for (int i = 0; i < 8; i++)
+        state[4 + i] = load32_le(key + 4 * i);
+    for (int i = 0; i < 4; i++)
+        state[12 + i] = load32_le(nonce + 4 * i);
+    hchacha20_block(subkey, state);
+
+    volatile uint32_t *p = state;
+    for (int i = 0; i < 16; i++)
+        p[i] = 0;
+}
+
+void hchacha20(uint8_t subkey[32],
+               const uint8_t key[32],
+               const uint8_t nonce[16])
+{
+    uint32_t w[8];
+
+    hchacha20_words(w, key, nonce);
+    for (int i = 0; i < 8; i++) {
+        subkey[4 * i] = w[i];
+        subkey[4 * i + 1] = w[i] >> 8;
+        subkey[4 * i + 2] = w[i] >> 16;
+        subkey[4 * i + 3] = w[i] >> 24;
+    }
+
+    volatile uint32_t *p = w;
+    for (int i = 0; i < 8; i++)
+        p[i] = 0;
+}
+
+void xchacha20_init(chacha20_ctx_t *ctx,
+                    const uint8_t key[32],
+                    const uint8_t nonce[24],
+                    uint32_t ctr)
+{
+    for (int i = 0; i < 4; i++)
+        ctx->state[i] = chacha20_sigma[i];
+    hchacha20_words(ctx->state + 4, key, nonce);
+    ctx->state[12] = ctr;
+    ctx->state[13] = 0;
+    ctx->state[14] = load32_le(nonce + 16);
+    ctx->state[15] = load32_le(nonce + 20);
+    ctx->used = 64;
+}
+
+void xchacha20(uint8_t *out,
+               const uint8_t *in,
+               size_t inlen,
+               const uint8_t key[32],
+               const uint8_t nonce[24],
+               uint32_t ctr)
+{
+    uint32_t subkey[8], n[3];
+
+    /* the words are little endian in memory, as chacha20() reads them */
+    hchacha20_words(subkey, key, nonce);
+    n[0] = 0;
+    n[1] = load32_le(nonce + 16);
+    n[2] = load32_le(nonce + 20);
+    chacha20(out, in, inlen, (const uint8_t *) subkey, (const uint8_t *) n,
+             ctr);
+
+    volatile uint32_t *p = subkey;
+    for (int i = 0; i < 8; i++)
+        p[i] = 0;
+}
+
+void chacha20_update(chacha20_ctx_t *ctx,
+                     uint8_t *out,
+                     const uint8_t *in,
+                     size_t inlen)
+{
+    const uint8_t *ks = (const uint8_t *) ctx->ks;
+
+    /* the rest of the block in progress */
+    for (; inlen && ctx->used < 64; inlen--)
+        *out++ = *in++ ^ ks[ctx->used++];
+
+    /* whole blocks */
+    size_t bulk = inlen & ~(size_t) 63;
+    if (bulk) {
+        chacha20(out, in, bulk, (const uint8_t *) (ctx->state + 4),
+                 (const uint8_t *) (ctx->state + 13), ctx->state[12]);
+        ctx->state[12] += bulk >> 6;
+        out += bulk;
+        in += bulk;
+        inlen -= bulk;
+    }
+
+    /* a partial block: keep the rest of its keystream */
+    if (inlen) {
+        chacha20_block(ctx->ks, ctx->state);
+        ctx->state[12]++;
+        for (size_t i = 0; i < inlen; i++)
+            out[i] = in[i] ^ ks[i];
+        ctx->used = inlen;
+    }
+}
+
+void chacha20_final(chacha20_ctx_t *ctx)
+{
+    volatile uint32_t *p = (volatile uint32_t *) ctx;
+
+    for (size_t i = 0; i < sizeof(*ctx) / sizeof(uint32_t); i++)
+        p[i] = 0;
+}
+
+void chacha20_iov(const struct iovec_lite *in,
+                  struct iovec_lite *out,
+                  int cnt,
+                  const uint8_t key[32],
+                  const uint8_t nonce[12],
+                  uint32_t ctr)
+{
+    chacha20_ctx_t ctx;
+    size_t ioff = 0, ooff = 0;
+    int i = 0, o = 0;
+
+    chacha20_init(&ctx, key, nonce, ctr);
+    while (i < cnt && o < cnt) {
+        size_t n = in[i].len - ioff;
+        if (n > out[o].len - ooff)
+            n = out[o].len - ooff;
+
+        chacha20_update(&ctx, (uint8_t *) out[o].base + ooff,
+                        (const uint8_t *) in[i].base + ioff, n);
+        ioff += n;
+        ooff += n;
+        if (ioff == in[i].len) {
+            i++;
+            ioff = 0;
+        }
+        if (ooff == out[o].len) {
+            o++;
+            ooff = 0;
+        }
+    }
+    chacha20_final(&ctx);
+}
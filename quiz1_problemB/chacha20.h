@@ -0,0 +1,117 @@
+#ifndef CHACHA20_H
+#define CHACHA20_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* chacha20_asm.S: out = in ^ keystream for inlen bytes, starting at block
+ * ctr, with a 32-byte key and the 12-byte RFC 7539 nonce.  The pointers
+ * may have any alignment; word-aligned out and in take the faster path.
+ */
+void chacha20(uint8_t *out,
+              const uint8_t *in,
+              size_t inlen,
+              const uint8_t *key,
+              const uint8_t *nonce,
+              uint32_t ctr);
+
+/* The same with 8 and 12 rounds, for uses that need speed rather than a
+ * security margin: test data, hashing into buckets.  Not for secrets.
+ */
+void chacha8(uint8_t *out,
+             const uint8_t *in,
+             size_t inlen,
+             const uint8_t *key,
+             const uint8_t *nonce,
+             uint32_t ctr);
+void chacha12(uint8_t *out,
+              const uint8_t *in,
+              size_t inlen,
+              const uint8_t *key,
+              const uint8_t *nonce,
+              uint32_t ctr);
+
+/* chacha20_asm.S: one 64-byte keystream block for a state laid out as in
+ * RFC 7539: 4 constant words, 8 key words, the counter, 3 nonce words.
+ */
+void chacha20_block(uint32_t ks[16], const uint32_t state[16]);
+
+/* chacha20_asm.S: nblocks keystream blocks to word-aligned out with no
+ * input, advancing the counter word of state
+ */
+void chacha20_keystream(uint32_t *out, size_t nblocks, uint32_t state[16]);
+
+/* ============= XChaCha20 =============
+ *
+ * A 24-byte nonce, safe to pick at random.  HChaCha20 turns the key and
+ * the first 16 nonce bytes into a subkey; the message is then plain
+ * ChaCha20 under the subkey with the nonce 4 zero bytes and the last 8
+ * nonce bytes.  The derivation is one block's rounds per message.
+ */
+
+/* chacha20_asm.S: the subkey for a state of 4 constant words, 8 key
+ * words and 4 nonce words
+ */
+void hchacha20_block(uint32_t subkey[8], const uint32_t state[16]);
+
+void hchacha20(uint8_t subkey[32],
+               const uint8_t key[32],
+               const uint8_t nonce[16]);
+void xchacha20(uint8_t *out,
+               const uint8_t *in,
+               size_t inlen,
+               const uint8_t key[32],
+               const uint8_t nonce[24],
+               uint32_t ctr);
+
+/* ============= Streaming =============
+ *
+ * The context holds the state words and the keystream of the block in
+ * progress, so a stream can be fed in pieces of any size and comes out
+ * the same as one chacha20() call over all of it.  Whole blocks go
+ * straight to chacha20(); a partial block is xored against the buffered
+ * keystream, which is generated once per block and kept across calls.
+ */
+typedef struct {
+    uint32_t state[16];
+    uint32_t ks[16];
+    uint32_t used; /* bytes of ks already consumed, 64 when none are left */
+} chacha20_ctx_t;
+
+void chacha20_init(chacha20_ctx_t *ctx,
+                   const uint8_t key[32],
+                   const uint8_t nonce[12],
+                   uint32_t ctr);
+void xchacha20_init(chacha20_ctx_t *ctx,
+                    const uint8_t key[32],
+                    const uint8_t nonce[24],
+                    uint32_t ctr);
+void chacha20_update(chacha20_ctx_t *ctx,
+                     uint8_t *out,
+                     const uint8_t *in,
+                     size_t inlen);
+
+/* Clear the key and the buffered keystream */
+void chacha20_final(chacha20_ctx_t *ctx);
+
+/* ============= Scatter/gather =============
+ *
+ * One stream over a packet held in pieces: in and out each list cnt
+ * fragments covering the same total length, in any split.  The two
+ * lists are walked together through a streaming context, so a block
+ * that straddles a fragment boundary is generated once.  An out
+ * fragment may be the same memory as its in fragment.
+ */
+struct iovec_lite {
+    void *base;
+    size_t len;
+};
+
+void chacha20_iov(const struct iovec_lite *in,
+                  struct iovec_lite *out,
+                  int cnt,
+                  const uint8_t key[32],
+                  const uint8_t nonce[12],
+                  uint32_t ctr);
+
+#endif
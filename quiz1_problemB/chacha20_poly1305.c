@@ -0,0 +1,140 @@
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "chacha20_poly1305.h"
+
+static const uint8_t zero_pad[16];
+
+/* Zeros up to the next multiple of 16 */
+static void pad16(poly1305_ctx_t *poly, uint32_t len)
+{
+    if (len & 15)
+        poly1305_update(poly, zero_pad, 16 - (len & 15));
+}
+
+static void begin_data(chacha20_poly1305_ctx_t *ctx)
+{
+    if (!ctx->in_data) {
+        pad16(&ctx->poly, ctx->aad_len);
+        ctx->in_data = true;
+    }
+}
+
+void chacha20_poly1305_init(chacha20_poly1305_ctx_t *ctx,
+                            const uint8_t key[32],
+                            const uint8_t nonce[12])
+{
+    uint32_t block0[16];
+
+    chacha20_init(&ctx->chacha, key, nonce, 0);
+    chacha20_block(block0, ctx->chacha.state);
+    ctx->chacha.state[12] = 1;
+    poly1305_init(&ctx->poly, (const uint8_t *) block0);
+
+    volatile uint32_t *p = block0;
+    for (int i = 0; i < 16; i++)
+        p[i] = 0;
+
+    ctx->aad_len = 0;
+    ctx->data_len = 0;
+    ctx->in_data = false;
+}
+
+void chacha20_poly1305_aad(chacha20_poly1305_ctx_t *ctx,
+                           const uint8_t *aad,
+                           size_t len)
+{
+    poly1305_update(&ctx->poly, aad, len);
+    ctx->aad_len += len;
+}
+
+void chacha20_poly1305_encrypt(chacha20_poly1305_ctx_t *ctx,
+                               uint8_t *out,
+                               const uint8_t *in,
+                               size_t len)
+{
+    begin_data(ctx);
+    chacha20_update(&ctx->chacha, out, in, len);
+    poly1305_update(&ctx->poly, out, len);
+    ctx->data_len += len;
+}
+
+void chacha20_poly1305_decrypt(chacha20_poly1305_ctx_t *ctx,
+                               uint8_t *out,
+                               const uint8_t *in,
+                               size_t len)
+{
+    begin_data(ctx);
+    poly1305_update(&ctx->poly, in, len);
+    chacha20_update(&ctx->chacha, out, in, len);
+    ctx->data_len += len;
+}
+
+void chacha20_poly1305_final(chacha20_poly1305_ctx_t *ctx, uint8_t tag[16])
+{
+    uint8_t lens[16] = {0};
+
+    begin_data(ctx);
+    pad16(&ctx->poly, ctx->data_len);
+    for (int i = 0; i < 4; i++) {
+        lens[i] = ctx->aad_len >> (8 * i);
+        lens[8 + i] = ctx->data_len >> (8 * i);
+    }
+    poly1305_update(&ctx->poly, lens, 16);
+    poly1305_final(&ctx->poly, tag);
+    chacha20_final(&ctx->chacha);
+    ctx->aad_len = ctx->data_len = 0;
+    ctx->in_data = false;
+}
+
+bool chacha20_poly1305_verify(chacha20_poly1305_ctx_t *ctx,
+                              const uint8_t tag[16])
+{
+    uint8_t expect[16], diff = 0;
+
+    chacha20_poly1305_final(ctx, expect);
+    for (int i = 0; i < 16; i++)
+        diff |= expect[i] ^ tag[i];
+    return !diff;
+}
+
+void chacha20_poly1305_seal(uint8_t *out,
+                            uint8_t tag[16],
+                            const uint8_t *in,
+                            size_t len,
+                            const uint8_t *aad,
+                            size_t aad_len,
+                            const uint8_t key[32],
+                            const uint8_t nonce[12])
+{
+    chacha20_poly1305_ctx_t ctx;
+
+    chacha20_poly1305_init(&ctx, key, nonce);
+    chacha20_poly1305_aad(&ctx, aad, aad_len);
+    chacha20_poly1305_encrypt(&ctx, out, in, len);
+    chacha20_poly1305_final(&ctx, tag);
+}
+
+bool chacha20_poly1305_open(uint8_t *out,
+                            const uint8_t *in,
+                            size_t len,
+                            const uint8_t tag[16],
+                            const uint8_t *aad,
+                            size_t aad_len,
+                            const uint8_t key[32],
+                            const uint8_t nonce[12])
+{
+    chacha20_poly1305_ctx_t ctx;
+
+    chacha20_poly1305_init(&ctx, key, nonce);
+    chacha20_poly1305_aad(&ctx, aad, aad_len);
+    chacha20_poly1305_decrypt(&ctx, out, in, len);
+    if (chacha20_poly1305_verify(&ctx, tag))
+        return true;
+
+    volatile uint8_t *p = out;
+    for (size_t i = 0; i < len; i++)
+        p[i] = 0;
+    return false;
+}
@@ -0,0 +1,69 @@
+#ifndef CHACHA20_POLY1305_H
+#define CHACHA20_POLY1305_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "chacha20.h"
+#include "poly1305.h"
+
+/* ============= ChaCha20-Poly1305 AEAD (RFC 8439) =============
+ *
+ * The Poly1305 key is the first half of keystream block 0; the data is
+ * encrypted from block 1 on.  The tag covers the AAD and the ciphertext,
+ * each padded to 16 bytes, then both lengths as 64-bit little-endian
+ * words.  The streaming calls run in one pass: each piece of data is
+ * encrypted and authenticated, or authenticated and decrypted, in the
+ * same call.  Order: init, aad (any number, all before the data), then
+ * encrypt or decrypt (any number), then final or verify.
+ */
+typedef struct {
+    chacha20_ctx_t chacha;
+    poly1305_ctx_t poly;
+    uint32_t aad_len;
+    uint32_t data_len;
+    bool in_data; /* the AAD has been padded, data has started */
+} chacha20_poly1305_ctx_t;
+
+void chacha20_poly1305_init(chacha20_poly1305_ctx_t *ctx,
+                            const uint8_t key[32],
+                            const uint8_t nonce[12]);
+void chacha20_poly1305_aad(chacha20_poly1305_ctx_t *ctx,
+                           const uint8_t *aad,
+                           size_t len);
+void chacha20_poly1305_encrypt(chacha20_poly1305_ctx_t *ctx,
+                               uint8_t *out,
+                               const uint8_t *in,
+                               size_t len);
+void chacha20_poly1305_decrypt(chacha20_poly1305_ctx_t *ctx,
+                               uint8_t *out,
+                               const uint8_t *in,
+                               size_t len);
+
+/* Both clear the context.  verify compares in constant time and returns
+ * true if the tag matches; decrypted data must not be used otherwise.
+ */
+void chacha20_poly1305_final(chacha20_poly1305_ctx_t *ctx, uint8_t tag[16]);
+bool chacha20_poly1305_verify(chacha20_poly1305_ctx_t *ctx,
+                              const uint8_t tag[16]);
+
+/* One-shot forms.  open() clears out when the tag does not match. */
+void chacha20_poly1305_seal(uint8_t *out,
+                            uint8_t tag[16],
+                            const uint8_t *in,
+                            size_t len,
+                            const uint8_t *aad,
+                            size_t aad_len,
+                            const uint8_t key[32],
+                            const uint8_t nonce[12]);
+bool chacha20_poly1305_open(uint8_t *out,
+                            const uint8_t *in,
+                            size_t len,
+                            const uint8_t tag[16],
+                            const uint8_t *aad,
+                            size_t aad_len,
+                            const uint8_t key[32],
+                            const uint8_t nonce[12]);
+
+#endif
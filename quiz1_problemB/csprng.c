@@ -0,0 +1,70 @@
+#include <stddef.h>
+#include <stdint.h>
+
+#include "chacha20.h"
+#include "csprng.h"
+
+/* "expand 32-byte k", then key, counter and nonce, all zero until seeded */
+static uint32_t state[16] = {0x61707865, 0x3320646e, 0x79622d32, 0x6b206574};
+static uint32_t buf[CSPRNG_BUF_BYTES / 4];
+static uint32_t pos = CSPRNG_BUF_BYTES; /* bytes of buf already handed out */
+
+/* New keystream under the current key, whose first 32 bytes replace it */
+static void refill(void)
+{
+    chacha20_keystream(buf, CSPRNG_BLOCKS, state);
+    for (int i = 0; i < 8; i++) {
+        state[4 + i] = buf[i];
+        buf[i] = 0;
+    }
+    state[12] = 0;
+    pos = 32;
+}
+
+void csprng_seed(const uint8_t *seed, size_t len)
+{
+    uint8_t *key = (uint8_t *) (state + 4);
+
+    for (size_t i = 0; i < len; i++)
+        key[i & 31] ^= seed[i];
+    refill();
+}
+
+void csprng_fill(void *out, size_t n)
+{
+    uint8_t *p = out, *b = (uint8_t *) buf;
+
+    /* bytes are cleared from buf as they are handed out */
+    for (;;) {
+        for (; n && pos < CSPRNG_BUF_BYTES; n--) {
+            *p++ = b[pos];
+            b[pos++] = 0;
+        }
+        if (!n)
+            return;
+
+        /* whole blocks straight to an aligned buffer; then rekey */
+        if (n >= CSPRNG_BUF_BYTES && !((uintptr_t) p & 3)) {
+            size_t nblocks = n >> 6;
+            chacha20_keystream((uint32_t *) p, nblocks, state);
+            p += nblocks << 6;
+            n &= 63;
+        }
+        refill();
+    }
+}
+
+uint32_t csprng_u32(void)
+{
+    uint32_t v;
+
+    /* pos stays word aligned unless csprng_fill left it otherwise */
+    if (pos <= CSPRNG_BUF_BYTES - 4 && !(pos & 3)) {
+        v = buf[pos >> 2];
+        buf[pos >> 2] = 0;
+        pos += 4;
+        return v;
+    }
+    csprng_fill(&v, 4);
+    return v;
+}
@@ -0,0 +1,26 @@
+#ifndef CSPRNG_H
+#define CSPRNG_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* ============= ChaCha20 random generator =============
+ *
+ * Output is ChaCha20 keystream generated CSPRNG_BLOCKS blocks at a time
+ * into an internal buffer.  Each refill reseeds: the first 32 bytes of
+ * the new keystream become the next key and are never handed out, so a
+ * later state compromise does not reveal earlier output.  Large aligned
+ * requests are generated straight into the caller's buffer and followed
+ * by a refill, which rekeys the same way.  There is no entropy source on
+ * the target: until csprng_seed is called the key is all zeros.  Seed
+ * before use, and again whenever fresh entropy is at hand; it is mixed
+ * into the current key, which is then replaced by a refill.
+ */
+#define CSPRNG_BLOCKS 16
+#define CSPRNG_BUF_BYTES (64 * CSPRNG_BLOCKS)
+
+void csprng_seed(const uint8_t *seed, size_t len);
+void csprng_fill(void *buf, size_t n);
+uint32_t csprng_u32(void);
+
+#endif
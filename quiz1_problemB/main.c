@@ -2,6 +2,17 @@
 #include <stdint.h>
 #include <string.h>
 
+#include "bf16.h"
+#include "bf16_array.h"
+#include "bf16_asm.h"
+#include "bf16_gemm.h"
+#include "bf16_math.h"
+#include "bf16_mlp.h"
+#include "bf16x2.h"
+#include "chacha20.h"
+#include "chacha20_poly1305.h"
+#include "csprng.h"
+
 extern int test(void);
 
 #define printstr(ptr, length)                   \
@@ -38,6 +49,29 @@ void *memcpy(void *dest, const void *src, size_t n)
     return dest;
 }
 
+/* Bare metal memcmp implementation */
+int memcmp(const void *s1, const void *s2, size_t n)
+{
+    const uint8_t *a = (const uint8_t *) s1;
+    const uint8_t *b = (const uint8_t *) s2;
+    while (n--) {
+        if (*a != *b)
+            return *a - *b;
+        a++;
+        b++;
+    }
+    return 0;
+}
+
+/* Bare metal memset implementation */
+void *memset(void *dest, int c, size_t n)
+{
+    uint8_t *d = (uint8_t *) dest;
+    while (n--)
+        *d++ = (uint8_t) c;
+    return dest;
+}
+
 /* Software division for RV32I (no M extension) */
 static unsigned long udiv(unsigned long dividend, unsigned long divisor)
 {
@@ -145,302 +179,27 @@ static void print_dec(unsigned long val)
     printstr(p, (buf + sizeof(buf) - p));
 }
 
-/* ============= BFloat16 Implementation ============= */
-
-typedef struct {
-    uint16_t bits;
-} bf16_t;
-
-#define BF16_EXP_BIAS 127
-#define BF16_SIGN_MASK 0x8000U
-#define BF16_EXP_MASK 0x7F80U
-#define BF16_MANT_MASK 0x007FU
-
-#define BF16_NAN() ((bf16_t) {.bits = 0x7FC0})
-#define BF16_ZERO() ((bf16_t) {.bits = 0x0000})
-
-static const bf16_t bf16_one = {.bits = 0x3F80};
-static const bf16_t bf16_two = {.bits = 0x4000};
-
-static inline bool bf16_isnan(bf16_t a)
-{
-    return ((a.bits & BF16_EXP_MASK) == BF16_EXP_MASK) &&
-           (a.bits & BF16_MANT_MASK);
-}
-
-static inline bool bf16_isinf(bf16_t a)
+/* Same as print_dec() but without the trailing newline */
+static void print_dec_raw(unsigned long val)
 {
-    return ((a.bits & BF16_EXP_MASK) == BF16_EXP_MASK) &&
-           !(a.bits & BF16_MANT_MASK);
-}
-
-static inline bool bf16_iszero(bf16_t a)
-{
-    return !(a.bits & 0x7FFF);
-}
+    char buf[20];
+    char *p = buf + sizeof(buf) - 1;
 
-static inline unsigned clz(uint32_t x)
-{
-    int n = 32, c = 16;
-    do {
-        uint32_t y = x >> c;
-        if (y) {
-            n -= c;
-            x = y;
-        }
-        c >>= 1;
-    } while (c);
-    return n - x;
-}
-
-static inline bf16_t bf16_add(bf16_t a, bf16_t b)
-{
-    uint16_t sign_a = a.bits >> 15 & 0x1, sign_b = b.bits >> 15 & 1;
-    int16_t exp_a = a.bits >> 7 & 0xFF, exp_b = b.bits >> 7 & 0xFF;
-    uint16_t mant_a = a.bits & 0x7F, mant_b = b.bits & 0x7F;
-
-    /* Infinity and NaN */
-    if (exp_a == 0xFF) {
-        if (mant_a)
-            return a;
-        if (exp_b == 0xFF)
-            return (mant_b || sign_a == sign_b) ? b : BF16_NAN();
-        return a;
-    }
-
-    /* if a is normal/denormal, but b is infinity/NaN */
-    if (exp_b == 0xFF)
-        return b;
-
-    /* if a == 0, b == 0 */
-    if (!exp_a && !mant_a)
-        return b;
-    if (!exp_b && !mant_b)
-        return a;
-
-    /* if a, b is normal */
-    if (exp_a)
-        mant_a |= 0x80;
-    if (exp_b)
-        mant_b |= 0x80;
-
-    int16_t exp_diff = exp_a - exp_b;
-    uint16_t result_sign;
-    int16_t result_exp;
-    uint32_t result_mant;
-
-    /* deal with result of exp */
-    if (exp_diff > 0) {
-        result_exp = exp_b;
-        if (exp_diff > 8)
-            return a;
-        mant_a <<= exp_diff;
-    } else if (exp_diff < 0) {
-        result_exp = exp_a;
-        if (exp_diff < -8)
-            return b;
-        mant_b <<= -exp_diff;
-    } else
-        result_exp = exp_a;
-
-    if (sign_a == sign_b) {
-        result_sign = sign_a;
-        result_mant = (uint32_t) mant_a + mant_b;
-        uint32_t lz = clz(result_mant);
-        for (unsigned i = 0; i < 32 - lz - 8; i++) {
-            result_mant >>= 1;
-            if (++result_exp >= 255)
-                return BF16_NAN();
-        }
+    if (val == 0) {
+        *p = '0';
+        p--;
     } else {
-        if (mant_a >= mant_b) {
-            result_sign = sign_a;
-            result_mant = mant_a - mant_b;
-        } else {
-            result_sign = sign_b;
-            result_mant = mant_b - mant_a;
-        }
-        if (!result_mant)
-            return BF16_ZERO();
-        if (result_mant < 0x80) {
-            while (!(result_mant & 0x80)) {
-                result_mant <<= 1;
-                if (--result_exp <= 0)
-                    return BF16_ZERO();
-            }
-        } else {
-            uint32_t lz = clz(result_mant);
-            for (unsigned i = 0; i < 32 - lz - 8; i++) {
-                result_mant >>= 1;
-                if (++result_exp >= 255)
-                    return BF16_NAN();
-            }
-        }
-    }
-    return (bf16_t) {
-        .bits =
-            result_sign << 15 | (result_exp & 0xFF) << 7 | result_mant & 0x7F,
-    };
-}
-
-static inline bf16_t bf16_sub(bf16_t a, bf16_t b)
-{
-    b.bits ^= 0x8000U;
-    return bf16_add(a, b);
-}
-
-static inline bf16_t bf16_mul(bf16_t a, bf16_t b)
-{
-    uint16_t sign_a = (a.bits >> 15) & 1;
-    uint16_t sign_b = (b.bits >> 15) & 1;
-    int16_t exp_a = ((a.bits >> 7) & 0xFF);
-    int16_t exp_b = ((b.bits >> 7) & 0xFF);
-    uint16_t mant_a = a.bits & 0x7F;
-    uint16_t mant_b = b.bits & 0x7F;
-
-    uint16_t result_sign = sign_a ^ sign_b;
-
-    if (exp_a == 0xFF) {
-        if (mant_a)
-            return a;
-        if (!exp_b && !mant_b)
-            return BF16_NAN();
-        return (bf16_t) {.bits = (result_sign << 15) | 0x7F80};
-    }
-    if (exp_b == 0xFF) {
-        if (mant_b)
-            return b;
-        if (!exp_a && !mant_a)
-            return BF16_NAN();
-        return (bf16_t) {.bits = (result_sign << 15) | 0x7F80};
-    }
-    if ((!exp_a && !mant_a) || (!exp_b && !mant_b))
-        return (bf16_t) {.bits = result_sign << 15};
-
-    int16_t exp_adjust = 0;
-    if (!exp_a) {
-        while (!(mant_a & 0x80)) {
-            mant_a <<= 1;
-            exp_adjust--;
-        }
-        exp_a = 1;
-    } else
-        mant_a |= 0x80;
-    if (!exp_b) {
-        while (!(mant_b & 0x80)) {
-            mant_b <<= 1;
-            exp_adjust--;
-        }
-        exp_b = 1;
-    } else
-        mant_b |= 0x80;
-
-    uint32_t result_mant = (uint32_t) mant_a * mant_b;
-    int32_t result_exp = (int32_t) exp_a + exp_b - BF16_EXP_BIAS + exp_adjust;
-
-    if (result_mant & 0x8000) {
-        result_mant = (result_mant >> 8) & 0x7F;
-        result_exp++;
-    } else
-        result_mant = (result_mant >> 7) & 0x7F;
-
-    if (result_exp >= 0xFF)
-        return (bf16_t) {.bits = (result_sign << 15) | 0x7F80};
-    if (result_exp <= 0) {
-        if (result_exp < -6)
-            return (bf16_t) {.bits = result_sign << 15};
-        result_mant >>= (1 - result_exp);
-        result_exp = 0;
-    }
-
-    return (bf16_t) {.bits = (result_sign << 15) | ((result_exp & 0xFF) << 7) |
-                             (result_mant & 0x7F)};
-}
-
-static inline bf16_t bf16_div(bf16_t a, bf16_t b)
-{
-    uint16_t sign_a = (a.bits >> 15) & 1;
-    uint16_t sign_b = (b.bits >> 15) & 1;
-    int16_t exp_a = ((a.bits >> 7) & 0xFF);
-    int16_t exp_b = ((b.bits >> 7) & 0xFF);
-    uint16_t mant_a = a.bits & 0x7F;
-    uint16_t mant_b = b.bits & 0x7F;
-
-    uint16_t result_sign = sign_a ^ sign_b;
-
-    if (exp_b == 0xFF) {
-        if (mant_b)
-            return b;
-        /* Inf/Inf = NaN */
-        if (exp_a == 0xFF && !mant_a)
-            return BF16_NAN();
-        return (bf16_t) {.bits = result_sign << 15};
-    }
-    if (!exp_b && !mant_b) {
-        if (!exp_a && !mant_a)
-            return BF16_NAN();
-        return (bf16_t) {.bits = (result_sign << 15) | 0x7F80};
-    }
-    if (exp_a == 0xFF) {
-        if (mant_a)
-            return a;
-        return (bf16_t) {.bits = (result_sign << 15) | 0x7F80};
-    }
-    if (!exp_a && !mant_a)
-        return (bf16_t) {.bits = result_sign << 15};
-
-    if (exp_a)
-        mant_a |= 0x80;
-    if (exp_b)
-        mant_b |= 0x80;
-
-    uint32_t dividend = (uint32_t) mant_a << 15;
-    uint32_t divisor = mant_b;
-    uint32_t quotient = 0;
-
-    for (int i = 0; i < 16; i++) {
-        quotient <<= 1;
-        if (dividend >= (divisor << (15 - i))) {
-            dividend -= (divisor << (15 - i));
-            quotient |= 1;
-        }
-    }
-
-    int32_t result_exp = (int32_t) exp_a - exp_b + BF16_EXP_BIAS;
-
-    if (!exp_a)
-        result_exp--;
-    if (!exp_b)
-        result_exp++;
-
-    if (quotient & 0x8000)
-        quotient >>= 8;
-    else {
-        while (!(quotient & 0x8000) && result_exp > 1) {
-            quotient <<= 1;
-            result_exp--;
+        while (val > 0) {
+            *p = '0' + umod(val, 10);
+            p--;
+            val = udiv(val, 10);
         }
-        quotient >>= 8;
     }
-    quotient &= 0x7F;
 
-    if (result_exp >= 0xFF)
-        return (bf16_t) {.bits = (result_sign << 15) | 0x7F80};
-    if (result_exp <= 0)
-        return (bf16_t) {.bits = result_sign << 15};
-    return (bf16_t) {.bits = (result_sign << 15) | ((result_exp & 0xFF) << 7) |
-                             (quotient & 0x7F)};
+    p++;
+    printstr(p, (buf + sizeof(buf) - p));
 }
 
-/* ============= ChaCha20 Declaration ============= */
-
-extern void chacha20(uint8_t *out,
-                     const uint8_t *in,
-                     size_t inlen,
-                     const uint8_t *key,
-                     const uint8_t *nonce,
-                     uint32_t ctr);
-
 /* ============= Test Suite ============= */
 
 static void test_chacha20(void)
@@ -492,6 +251,566 @@ static void test_chacha20(void)
     }
 }
 
+/* chacha20_update in pieces of every size against one chacha20() call */
+static void test_chacha20_stream(void)
+{
+    static const uint8_t key[32] __attribute__((aligned(4))) = {
+        0,  1,  2,  3,  4,  5,  6,  7,  8,  9,  10, 11, 12, 13, 14, 15,
+        16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31};
+    static const uint8_t nonce[12] __attribute__((aligned(4))) = {
+        0, 0, 0, 0, 0, 0, 0, 74, 0, 0, 0, 0};
+    /* lengths of the pieces, used in turn until the stream runs out */
+    static const uint8_t pieces[][4] = {
+        {1, 1, 1, 1}, {7, 7, 7, 7},     {63, 63, 63, 63},
+        {64, 64, 64, 64}, {65, 3, 128, 0}, {200, 200, 200, 200},
+    };
+    static uint8_t in[304], ref[304], out[304];
+    chacha20_ctx_t ctx;
+    bool stream_ok = true, final_ok = true;
+
+    TEST_LOGGER("Test: ChaCha20 streaming (chacha20_ctx_t)\n");
+
+    for (size_t i = 0; i < sizeof(in); i++)
+        in[i] = i;
+    chacha20(ref, in, 300, key, nonce, 1);
+
+    /* aligned, then output and input off by one and three bytes */
+    for (size_t off = 0; off < 2; off++) {
+        for (size_t p = 0; p < sizeof(pieces) / sizeof(pieces[0]); p++) {
+            size_t done = 0, k = 0;
+
+            for (size_t i = 0; i < 300; i++)
+                in[3 * off + i] = i;
+            chacha20_init(&ctx, key, nonce, 1);
+            while (done < 300) {
+                size_t n = pieces[p][k++ & 3];
+                if (n > 300 - done)
+                    n = 300 - done;
+                chacha20_update(&ctx, out + off + done, in + 3 * off + done,
+                                n);
+                done += n;
+            }
+            if (memcmp(out + off, ref, 300))
+                stream_ok = false;
+        }
+    }
+
+    chacha20_final(&ctx);
+    for (size_t i = 0; i < sizeof(ctx) / sizeof(uint32_t); i++)
+        if (((const uint32_t *) &ctx)[i])
+            final_ok = false;
+
+    if (stream_ok) {
+        TEST_LOGGER("  pieces of 1 to 200 bytes, aligned and not: PASSED\n");
+    } else {
+        TEST_LOGGER("  pieces of 1 to 200 bytes, aligned and not: FAILED\n");
+    }
+    if (final_ok) {
+        TEST_LOGGER("  chacha20_final clears the context: PASSED\n");
+    } else {
+        TEST_LOGGER("  chacha20_final clears the context: FAILED\n");
+    }
+}
+
+/* chacha20() at every byte offset of out, in, key and nonce, for every
+ * length up to two blocks and a bit; the reference is whole aligned
+ * blocks, and the bytes around the output must stay untouched
+ */
+static void test_chacha20_unaligned(void)
+{
+    static const uint8_t offs[][4] = {
+        {0, 0, 0, 0}, {1, 3, 0, 0}, {2, 2, 1, 2}, {3, 1, 3, 3}, {0, 2, 2, 1},
+    };
+    static uint8_t key[36] __attribute__((aligned(4)));
+    static uint8_t nonce[16] __attribute__((aligned(4)));
+    static uint8_t in[200] __attribute__((aligned(4)));
+    static uint8_t ref[192] __attribute__((aligned(4)));
+    static uint8_t out[200] __attribute__((aligned(4)));
+    bool data_ok = true, bounds_ok = true;
+
+    TEST_LOGGER("Test: ChaCha20 unaligned buffers\n");
+
+    for (size_t i = 0; i < 32; i++)
+        key[i] = 0x80 + i;
+    for (size_t i = 0; i < 12; i++)
+        nonce[i] = 0x40 + i;
+    for (size_t i = 0; i < 192; i++)
+        in[i] = i;
+    chacha20(ref, in, 192, key, nonce, 7);
+
+    for (size_t o = 0; o < sizeof(offs) / sizeof(offs[0]); o++) {
+        uint8_t *po = out + offs[o][0], *pi = in + offs[o][1];
+        uint8_t *pk = key + offs[o][2], *pn = nonce + offs[o][3];
+
+        for (size_t i = 0; i < 32; i++)
+            pk[i] = 0x80 + i;
+        for (size_t i = 0; i < 12; i++)
+            pn[i] = 0x40 + i;
+        for (size_t i = 0; i < 192; i++)
+            pi[i] = i;
+
+        for (size_t n = 0; n <= 140; n++) {
+            for (size_t i = 0; i < sizeof(out); i++)
+                out[i] = 0xA5;
+            chacha20(po, pi, n, pk, pn, 7);
+            if (memcmp(po, ref, n))
+                data_ok = false;
+            for (size_t i = 0; i < sizeof(out); i++)
+                if ((out + i < po || out + i >= po + n) && out[i] != 0xA5)
+                    bounds_ok = false;
+        }
+    }
+
+    if (data_ok) {
+        TEST_LOGGER("  every offset and length 0..140: PASSED\n");
+    } else {
+        TEST_LOGGER("  every offset and length 0..140: FAILED\n");
+    }
+    if (bounds_ok) {
+        TEST_LOGGER("  nothing written past the output: PASSED\n");
+    } else {
+        TEST_LOGGER("  nothing written past the output: FAILED\n");
+    }
+}
+
+/* HChaCha20 and XChaCha20 vectors from draft-irtf-cfrg-xchacha-03
+ * (2.2.1, and the first 96 bytes of A.3.2), then xchacha20 at odd
+ * offsets and fed through xchacha20_init and chacha20_update
+ */
+static void test_xchacha20(void)
+{
+    static const uint8_t h_nonce[16] = {0x00, 0x00, 0x00, 0x09, 0x00, 0x00,
+                                        0x00, 0x4a, 0x00, 0x00, 0x00, 0x00,
+                                        0x31, 0x41, 0x59, 0x27};
+    static const uint8_t h_exp[32] = {
+        0x82, 0x41, 0x3b, 0x42, 0x27, 0xb2, 0x7b, 0xfe, 0xd3, 0x0e, 0x42,
+        0x50, 0x8a, 0x87, 0x7d, 0x73, 0xa0, 0xf9, 0xe4, 0xd5, 0x8a, 0x74,
+        0xa8, 0x53, 0xc1, 0x2e, 0xc4, 0x13, 0x26, 0xd3, 0xec, 0xdc};
+    static const uint8_t pt[96] =
+        "The dhole (pronounced \"dole\") is also known as the Asiatic wild "
+        "dog, red dog, and whistling dog.";
+    static const uint8_t exp[96] = {
+        0x7d, 0x0a, 0x2e, 0x6b, 0x7f, 0x7c, 0x65, 0xa2, 0x36, 0x54, 0x26, 0x30,
+        0x29, 0x4e, 0x06, 0x3b, 0x7a, 0xb9, 0xb5, 0x55, 0xa5, 0xd5, 0x14, 0x9a,
+        0xa2, 0x1e, 0x4a, 0xe1, 0xe4, 0xfb, 0xce, 0x87, 0xec, 0xc8, 0xe0, 0x8a,
+        0x8b, 0x5e, 0x35, 0x0a, 0xbe, 0x62, 0x2b, 0x2f, 0xfa, 0x61, 0x7b, 0x20,
+        0x2c, 0xfa, 0xd7, 0x20, 0x32, 0xa3, 0x03, 0x7e, 0x76, 0xff, 0xdc, 0xdc,
+        0x43, 0x76, 0xee, 0x05, 0x3a, 0x19, 0x0d, 0x7e, 0x46, 0xca, 0x1d, 0xe0,
+        0x41, 0x44, 0x85, 0x03, 0x81, 0xb9, 0xcb, 0x29, 0xf0, 0x51, 0x91, 0x53,
+        0x86, 0xb8, 0xa7, 0x10, 0xb8, 0xac, 0x4d, 0x02, 0x7b, 0x8b, 0x05, 0x0f};
+    static uint8_t key[33], nonce[25], subkey[32], out[100];
+    chacha20_ctx_t ctx;
+    bool odd_ok = true, stream_ok = true;
+
+    TEST_LOGGER("Test: XChaCha20\n");
+
+    for (size_t i = 0; i < 32; i++)
+        key[i] = i;
+    hchacha20(subkey, key, h_nonce);
+    if (!memcmp(subkey, h_exp, 32)) {
+        TEST_LOGGER("  HChaCha20 subkey: PASSED\n");
+    } else {
+        TEST_LOGGER("  HChaCha20 subkey: FAILED\n");
+    }
+
+    for (size_t i = 0; i < 32; i++)
+        key[i] = 0x80 + i;
+    for (size_t i = 0; i < 24; i++)
+        nonce[i] = 0x40 + i;
+    nonce[23] = 0x58;
+    xchacha20(out, pt, 96, key, nonce, 1);
+    if (!memcmp(out, exp, 96)) {
+        TEST_LOGGER("  XChaCha20 vector: PASSED\n");
+    } else {
+        TEST_LOGGER("  XChaCha20 vector: FAILED\n");
+    }
+
+    /* key, nonce and output one byte off word alignment */
+    for (size_t i = 0; i < 32; i++)
+        key[1 + i] = 0x80 + i;
+    for (size_t i = 0; i < 24; i++)
+        nonce[1 + i] = 0x40 + i;
+    nonce[24] = 0x58;
+    xchacha20(out + 1, pt, 96, key + 1, nonce + 1, 1);
+    if (memcmp(out + 1, exp, 96))
+        odd_ok = false;
+    if (odd_ok) {
+        TEST_LOGGER("  unaligned key, nonce and output: PASSED\n");
+    } else {
+        TEST_LOGGER("  unaligned key, nonce and output: FAILED\n");
+    }
+
+    xchacha20_init(&ctx, key + 1, nonce + 1, 1);
+    for (size_t done = 0; done < 96; done += 13) {
+        size_t n = 96 - done < 13 ? 96 - done : 13;
+        chacha20_update(&ctx, out + done, pt + done, n);
+    }
+    chacha20_final(&ctx);
+    if (memcmp(out, exp, 96))
+        stream_ok = false;
+    if (stream_ok) {
+        TEST_LOGGER("  xchacha20_init, pieces of 13 bytes: PASSED\n");
+    } else {
+        TEST_LOGGER("  xchacha20_init, pieces of 13 bytes: FAILED\n");
+    }
+}
+
+/* chacha20_keystream against chacha20 over zeros, then the generator's
+ * output from a fresh seed against the same stream built from chacha20:
+ * each 1 KiB refill gives away all but its first 32 bytes, which are the
+ * next key.  This must be the first use of the generator.
+ */
+static void test_csprng(void)
+{
+    static const uint8_t zero[12];
+    static uint32_t ks[64];
+    static uint8_t seed[32], key[32], ref[4096], g[CSPRNG_BUF_BYTES];
+    static uint8_t out[4096] __attribute__((aligned(4)));
+    chacha20_ctx_t ctx;
+    bool ks_ok = true, stream_ok = true;
+
+    TEST_LOGGER("Test: ChaCha20 CSPRNG\n");
+
+    for (size_t i = 0; i < 32; i++)
+        seed[i] = 0xC0 + i;
+    chacha20_init(&ctx, seed, zero, 0xFFFFFFFE);
+    for (size_t nb = 0; nb <= 4; nb++) {
+        memset(ref, 0, 256);
+        chacha20(ref, ref, nb * 64, seed, zero, ctx.state[12]);
+        chacha20_keystream(ks, nb, ctx.state);
+        if (memcmp(ks, ref, nb * 64))
+            ks_ok = false;
+    }
+    if (ctx.state[12] != 8)
+        ks_ok = false;
+    if (ks_ok) {
+        TEST_LOGGER("  chacha20_keystream, counter wraps: PASSED\n");
+    } else {
+        TEST_LOGGER("  chacha20_keystream, counter wraps: FAILED\n");
+    }
+
+    /* three refills: 992 + 992 + 16 bytes, four words, then 960 bytes
+     * and 3136 generated in place under the fourth key
+     */
+    memcpy(key, seed, 32);
+    for (size_t r = 0; r < 3; r++) {
+        memset(g, 0, sizeof(g));
+        chacha20(g, g, sizeof(g), key, zero, 0);
+        memcpy(key, g, 32);
+        memcpy(ref + 992 * r, g + 32, 992);
+    }
+    csprng_seed(seed, 32);
+    csprng_fill(out, 2000);
+    for (size_t i = 0; i < 4; i++) {
+        uint32_t v = csprng_u32();
+        memcpy(out + 2000 + 4 * i, &v, 4);
+    }
+    if (memcmp(out, ref, 2016))
+        stream_ok = false;
+
+    memcpy(ref, ref + 2016, 960);
+    memset(ref + 960, 0, 3136);
+    chacha20(ref + 960, ref + 960, 3136, key, zero, 0);
+    csprng_fill(out, 4096);
+    if (memcmp(out, ref, 4096))
+        stream_ok = false;
+
+    if (stream_ok) {
+        TEST_LOGGER("  refills, csprng_u32 and the in-place path: PASSED\n");
+    } else {
+        TEST_LOGGER("  refills, csprng_u32 and the in-place path: FAILED\n");
+    }
+}
+
+/* Keystream block 0 for the all-zero key and nonce at 8, 12 and 20
+ * rounds (the TC1 vectors of draft-strombergson-chacha-test-vectors),
+ * and each variant over several blocks against one call per block
+ */
+static void test_chacha_rounds(void)
+{
+    typedef void (*chacha_fn)(uint8_t *, const uint8_t *, size_t,
+                              const uint8_t *, const uint8_t *, uint32_t);
+    static const struct {
+        chacha_fn fn;
+        uint8_t exp[64];
+    } cases[] = {
+        {chacha8,
+         {0x3e, 0x00, 0xef, 0x2f, 0x89, 0x5f, 0x40, 0xd6, 0x7f, 0x5b, 0xb8,
+          0xe8, 0x1f, 0x09, 0xa5, 0xa1, 0x2c, 0x84, 0x0e, 0xc3, 0xce, 0x9a,
+          0x7f, 0x3b, 0x18, 0x1b, 0xe1, 0x88, 0xef, 0x71, 0x1a, 0x1e, 0x98,
+          0x4c, 0xe1, 0x72, 0xb9, 0x21, 0x6f, 0x41, 0x9f, 0x44, 0x53, 0x67,
+          0x45, 0x6d, 0x56, 0x19, 0x31, 0x4a, 0x42, 0xa3, 0xda, 0x86, 0xb0,
+          0x01, 0x38, 0x7b, 0xfd, 0xb8, 0x0e, 0x0c, 0xfe, 0x42}},
+        {chacha12,
+         {0x9b, 0xf4, 0x9a, 0x6a, 0x07, 0x55, 0xf9, 0x53, 0x81, 0x1f, 0xce,
+          0x12, 0x5f, 0x26, 0x83, 0xd5, 0x04, 0x29, 0xc3, 0xbb, 0x49, 0xe0,
+          0x74, 0x14, 0x7e, 0x00, 0x89, 0xa5, 0x2e, 0xae, 0x15, 0x5f, 0x05,
+          0x64, 0xf8, 0x79, 0xd2, 0x7a, 0xe3, 0xc0, 0x2c, 0xe8, 0x28, 0x34,
+          0xac, 0xfa, 0x8c, 0x79, 0x3a, 0x62, 0x9f, 0x2c, 0xa0, 0xde, 0x69,
+          0x19, 0x61, 0x0b, 0xe8, 0x2f, 0x41, 0x13, 0x26, 0xbe}},
+        {chacha20,
+         {0x76, 0xb8, 0xe0, 0xad, 0xa0, 0xf1, 0x3d, 0x90, 0x40, 0x5d, 0x6a,
+          0xe5, 0x53, 0x86, 0xbd, 0x28, 0xbd, 0xd2, 0x19, 0xb8, 0xa0, 0x8d,
+          0xed, 0x1a, 0xa8, 0x36, 0xef, 0xcc, 0x8b, 0x77, 0x0d, 0xc7, 0xda,
+          0x41, 0x59, 0x7c, 0x51, 0x57, 0x48, 0x8d, 0x77, 0x24, 0xe0, 0x3f,
+          0xb8, 0xd8, 0x4a, 0x37, 0x6a, 0x43, 0xb8, 0xf4, 0x15, 0x18, 0xa1,
+          0x1c, 0xc3, 0x87, 0xb6, 0x69, 0xb2, 0xee, 0x65, 0x86}},
+    };
+    static const uint8_t zero[200];
+    static uint8_t key[32], nonce[12], out[200], ref[200];
+    bool kat_ok = true, blocks_ok = true;
+
+    TEST_LOGGER("Test: ChaCha8 / ChaCha12 / ChaCha20\n");
+
+    for (size_t i = 0; i < 32; i++)
+        key[i] = 0x80 + i;
+    for (size_t i = 0; i < 12; i++)
+        nonce[i] = 0x40 + i;
+
+    for (size_t v = 0; v < sizeof(cases) / sizeof(cases[0]); v++) {
+        cases[v].fn(out, zero, 64, zero, zero, 0);
+        if (memcmp(out, cases[v].exp, 64))
+            kat_ok = false;
+
+        cases[v].fn(out, zero, 200, key, nonce, 5);
+        for (size_t i = 0; i < 200; i += 64)
+            cases[v].fn(ref + i, zero + i, 200 - i < 64 ? 200 - i : 64, key,
+                        nonce, 5 + (i >> 6));
+        if (memcmp(out, ref, 200))
+            blocks_ok = false;
+    }
+
+    if (kat_ok) {
+        TEST_LOGGER("  zero key and nonce, all three: PASSED\n");
+    } else {
+        TEST_LOGGER("  zero key and nonce, all three: FAILED\n");
+    }
+    if (blocks_ok) {
+        TEST_LOGGER("  200 bytes against one call per block: PASSED\n");
+    } else {
+        TEST_LOGGER("  200 bytes against one call per block: FAILED\n");
+    }
+}
+
+/* chacha20_iov over a packet in fragments of 13, 0, 1, 64, 100, 7 and
+ * 16 bytes against one chacha20() call: into the same split, into one
+ * flat buffer, and in place
+ */
+static void test_chacha20_iov(void)
+{
+    static const uint8_t lens[7] = {13, 0, 1, 64, 100, 7, 16};
+    static const uint8_t key[32] = {1, 2, 3, 4, 5, 6, 7, 8, 9};
+    static const uint8_t nonce[12] = {0, 0, 0, 9};
+    static uint8_t pkt[201], ref[201], frag_in[201], frag_out[201 + 7];
+    struct iovec_lite in[7], out[7];
+    bool split_ok = true, flat_ok = true, inplace_ok = true;
+    size_t off = 0;
+
+    TEST_LOGGER("Test: ChaCha20 scatter/gather\n");
+
+    for (size_t i = 0; i < sizeof(pkt); i++)
+        pkt[i] = i * 7;
+    chacha20(ref, pkt, sizeof(pkt), key, nonce, 3);
+
+    /* out fragments one byte apart, so they are not contiguous */
+    for (size_t f = 0; f < 7; f++) {
+        in[f].base = frag_in + off;
+        in[f].len = lens[f];
+        out[f].base = frag_out + off + f;
+        out[f].len = lens[f];
+        off += lens[f];
+    }
+    memcpy(frag_in, pkt, sizeof(pkt));
+
+    chacha20_iov(in, out, 7, key, nonce, 3);
+    for (size_t f = 0, done = 0; f < 7; done += lens[f++])
+        if (memcmp(out[f].base, ref + done, lens[f]))
+            split_ok = false;
+    if (split_ok) {
+        TEST_LOGGER("  fragments to fragments: PASSED\n");
+    } else {
+        TEST_LOGGER("  fragments to fragments: FAILED\n");
+    }
+
+    /* the same fragments into one buffer: cnt entries, the rest empty */
+    out[0].base = frag_out;
+    out[0].len = sizeof(pkt);
+    for (size_t f = 1; f < 7; f++)
+        out[f].len = 0;
+    chacha20_iov(in, out, 7, key, nonce, 3);
+    if (memcmp(frag_out, ref, sizeof(pkt)))
+        flat_ok = false;
+    if (flat_ok) {
+        TEST_LOGGER("  fragments to one buffer: PASSED\n");
+    } else {
+        TEST_LOGGER("  fragments to one buffer: FAILED\n");
+    }
+
+    chacha20_iov(in, in, 7, key, nonce, 3);
+    if (memcmp(frag_in, ref, sizeof(pkt)))
+        inplace_ok = false;
+    if (inplace_ok) {
+        TEST_LOGGER("  in place: PASSED\n");
+    } else {
+        TEST_LOGGER("  in place: FAILED\n");
+    }
+}
+
+/* Poly1305 over m with a key of r and s bytes set from the low ends */
+static bool poly1305_case(const uint8_t *r,
+                          size_t r_len,
+                          const uint8_t *s,
+                          size_t s_len,
+                          const uint8_t *m,
+                          size_t len,
+                          const uint8_t *expect)
+{
+    static poly1305_ctx_t ctx;
+    uint8_t key[32] = {0}, tag[16];
+
+    memcpy(key, r, r_len);
+    memcpy(key + 16, s, s_len);
+    poly1305_init(&ctx, key);
+    poly1305_update(&ctx, m, len);
+    poly1305_final(&ctx, tag);
+    return !memcmp(tag, expect, 16);
+}
+
+/* RFC 8439 sections 2.5.2 and 2.8.2 and the Poly1305 edge cases of A.3,
+ * then the AEAD fed in pieces, and open() of a tampered message
+ */
+static void test_chacha20_poly1305(void)
+{
+    static const uint8_t poly_key[32] = {
+        0x85, 0xd6, 0xbe, 0x78, 0x57, 0x55, 0x6d, 0x33, 0x7f, 0x44, 0x52,
+        0xfe, 0x42, 0xd5, 0x06, 0xa8, 0x01, 0x03, 0x80, 0x8a, 0xfb, 0x0d,
+        0xb2, 0xfd, 0x4a, 0xbf, 0xf6, 0xaf, 0x41, 0x49, 0xf5, 0x1b};
+    static const uint8_t poly_tag[16] = {0xa8, 0x06, 0x1d, 0xc1, 0x30, 0x51,
+                                         0x36, 0xc6, 0xc2, 0x2b, 0x8b, 0xaf,
+                                         0x0c, 0x01, 0x27, 0xa9};
+    static const uint8_t nonce[12] = {0x07, 0x00, 0x00, 0x00, 0x40, 0x41,
+                                      0x42, 0x43, 0x44, 0x45, 0x46, 0x47};
+    static const uint8_t aad[12] = {0x50, 0x51, 0x52, 0x53, 0xc0, 0xc1,
+                                    0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7};
+    static const uint8_t pt[114] =
+        "Ladies and Gentlemen of the class of '99: If I could offer you only "
+        "one tip for the future, sunscreen would be it.";
+    static const uint8_t exp[114] = {
+        0xd3, 0x1a, 0x8d, 0x34, 0x64, 0x8e, 0x60, 0xdb, 0x7b, 0x86, 0xaf, 0xbc,
+        0x53, 0xef, 0x7e, 0xc2, 0xa4, 0xad, 0xed, 0x51, 0x29, 0x6e, 0x08, 0xfe,
+        0xa9, 0xe2, 0xb5, 0xa7, 0x36, 0xee, 0x62, 0xd6, 0x3d, 0xbe, 0xa4, 0x5e,
+        0x8c, 0xa9, 0x67, 0x12, 0x82, 0xfa, 0xfb, 0x69, 0xda, 0x92, 0x72, 0x8b,
+        0x1a, 0x71, 0xde, 0x0a, 0x9e, 0x06, 0x0b, 0x29, 0x05, 0xd6, 0xa5, 0xb6,
+        0x7e, 0xcd, 0x3b, 0x36, 0x92, 0xdd, 0xbd, 0x7f, 0x2d, 0x77, 0x8b, 0x8c,
+        0x98, 0x03, 0xae, 0xe3, 0x28, 0x09, 0x1b, 0x58, 0xfa, 0xb3, 0x24, 0xe4,
+        0xfa, 0xd6, 0x75, 0x94, 0x55, 0x85, 0x80, 0x8b, 0x48, 0x31, 0xd7, 0xbc,
+        0x3f, 0xf4, 0xde, 0xf0, 0x8e, 0x4b, 0x7a, 0x9d, 0xe5, 0x76, 0xd2, 0x65,
+        0x86, 0xce, 0xc6, 0x4b, 0x61, 0x16};
+    static const uint8_t exp_tag[16] = {0x1a, 0xe1, 0x0b, 0x59, 0x4f, 0x09,
+                                        0xe2, 0x6a, 0x7e, 0x90, 0x2e, 0xcb,
+                                        0xd0, 0x60, 0x06, 0x91};
+    /* A.3 #5 to #9: r = 1 or 2, s = 0 or all ones */
+    static const uint8_t one[16] = {1}, two[16] = {2};
+    static const uint8_t ones[48] = {
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0xff, 0xff, 0xff, 0xff, 0xf0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00};
+    static const uint8_t fb[48] = {
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0xff, 0xff, 0xff, 0xff, 0xfb, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe,
+        0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0xfe, 0x01, 0x01, 0x01, 0x01,
+        0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01};
+    static const uint8_t fd[16] = {0xfd, 0xff, 0xff, 0xff, 0xff, 0xff,
+                                   0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+                                   0xff, 0xff, 0xff, 0xff};
+    static const uint8_t tag3[16] = {3}, tag5[16] = {5}, tag0[16] = {0};
+    static const uint8_t tag_fa[16] = {0xfa, 0xff, 0xff, 0xff, 0xff, 0xff,
+                                       0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+                                       0xff, 0xff, 0xff, 0xff};
+    static const uint8_t pieces[] = {1, 7, 16, 63, 64, 200};
+    static chacha20_poly1305_ctx_t ctx;
+    static uint8_t key[32], out[120], back[120];
+    uint8_t tag[16];
+    bool edge_ok, stream_ok = true, open_ok, reject_ok;
+
+    TEST_LOGGER("Test: ChaCha20-Poly1305\n");
+
+    if (poly1305_case(poly_key, 16, poly_key + 16, 16,
+                      (const uint8_t *) "Cryptographic Forum Research Group",
+                      34, poly_tag)) {
+        TEST_LOGGER("  Poly1305 RFC 8439 2.5.2: PASSED\n");
+    } else {
+        TEST_LOGGER("  Poly1305 RFC 8439 2.5.2: FAILED\n");
+    }
+
+    edge_ok = poly1305_case(two, 16, ones, 0, ones, 16, tag3) &&
+              poly1305_case(two, 16, ones, 16, two, 16, tag3) &&
+              poly1305_case(one, 16, ones, 0, ones, 48, tag5) &&
+              poly1305_case(one, 16, ones, 0, fb, 48, tag0) &&
+              poly1305_case(two, 16, ones, 0, fd, 16, tag_fa);
+    if (edge_ok) {
+        TEST_LOGGER("  Poly1305 reduction edge cases: PASSED\n");
+    } else {
+        TEST_LOGGER("  Poly1305 reduction edge cases: FAILED\n");
+    }
+
+    for (size_t i = 0; i < 32; i++)
+        key[i] = 0x80 + i;
+    chacha20_poly1305_seal(out, tag, pt, 114, aad, 12, key, nonce);
+    if (!memcmp(out, exp, 114) && !memcmp(tag, exp_tag, 16)) {
+        TEST_LOGGER("  AEAD RFC 8439 2.8.2: PASSED\n");
+    } else {
+        TEST_LOGGER("  AEAD RFC 8439 2.8.2: FAILED\n");
+    }
+
+    /* AAD in two parts, data in pieces, out one byte off alignment */
+    for (size_t p = 0; p < sizeof(pieces); p++) {
+        size_t n;
+
+        chacha20_poly1305_init(&ctx, key, nonce);
+        chacha20_poly1305_aad(&ctx, aad, 5);
+        chacha20_poly1305_aad(&ctx, aad + 5, 7);
+        for (size_t done = 0; done < 114; done += n) {
+            n = pieces[p] < 114 - done ? pieces[p] : 114 - done;
+            chacha20_poly1305_encrypt(&ctx, out + 1 + done, pt + done, n);
+        }
+        chacha20_poly1305_final(&ctx, tag);
+        if (memcmp(out + 1, exp, 114) || memcmp(tag, exp_tag, 16))
+            stream_ok = false;
+
+        chacha20_poly1305_init(&ctx, key, nonce);
+        chacha20_poly1305_aad(&ctx, aad, 12);
+        for (size_t done = 0; done < 114; done += n) {
+            n = pieces[p] < 114 - done ? pieces[p] : 114 - done;
+            chacha20_poly1305_decrypt(&ctx, back + done, out + 1 + done, n);
+        }
+        if (!chacha20_poly1305_verify(&ctx, exp_tag) || memcmp(back, pt, 114))
+            stream_ok = false;
+    }
+    if (stream_ok) {
+        TEST_LOGGER("  streaming in pieces of 1 to 200 bytes: PASSED\n");
+    } else {
+        TEST_LOGGER("  streaming in pieces of 1 to 200 bytes: FAILED\n");
+    }
+
+    open_ok = chacha20_poly1305_open(back, exp, 114, exp_tag, aad, 12, key,
+                                     nonce) &&
+              !memcmp(back, pt, 114);
+    memcpy(tag, exp_tag, 16);
+    tag[15] ^= 0x80;
+    reject_ok = !chacha20_poly1305_open(back, exp, 114, tag, aad, 12, key,
+                                        nonce);
+    for (size_t i = 0; i < 114; i++)
+        if (back[i])
+            reject_ok = false;
+    if (open_ok && reject_ok) {
+        TEST_LOGGER("  open, and reject a tampered tag: PASSED\n");
+    } else {
+        TEST_LOGGER("  open, and reject a tampered tag: FAILED\n");
+    }
+}
+
 static void test_bf16_add(void)
 {
     TEST_LOGGER("Test: bf16_add\n");
@@ -600,73 +919,2120 @@ static void test_bf16_special_cases(void)
     }
 }
 
-int main(void)
+static void test_bf16_array(void)
 {
-    uint64_t start_cycles, end_cycles, cycles_elapsed;
-    uint64_t start_instret, end_instret, instret_elapsed;
+    /* Mix of normals and every special class, so both the fast blocks and
+     * the scalar fallback blocks are exercised.
+     */
+    static const bf16_t a[19] = {
+        {0x3F80}, {0x4040}, {0xC0A0}, {0x3E00}, {0x4000}, {0x0000},
+        {0x7F80}, {0x3F81}, {0x0040}, {0x7FC0}, {0x8000}, {0x7F00},
+        {0x4120}, {0xBF80}, {0x0080}, {0x42C8}, {0x3DCC}, {0xFF80},
+        {0x4049},
+    };
+    static const bf16_t b[19] = {
+        {0x3F80}, {0x4000}, {0x4000}, {0xBE00}, {0x3F00}, {0x4000},
+        {0x4000}, {0x3F80}, {0x3F80}, {0x3F80}, {0x0000}, {0x7F00},
+        {0x4120}, {0x3F80}, {0x0080}, {0xC2C8}, {0x3DCC}, {0xFF80},
+        {0x0001},
+    };
+    const bf16_t alpha = {.bits = 0x3FC0}; /* 1.5 */
+    bf16_t out[19], y[19];
+    bool passed;
+    size_t i;
 
-    TEST_LOGGER("\n=== ChaCha20 Tests ===\n\n");
+    TEST_LOGGER("Test: bf16 array kernels\n");
 
-    /* Test 0: ChaCha20 */
-    TEST_LOGGER("Test 0: ChaCha20 (RISC-V Assembly)\n");
-    start_cycles = get_cycles();
-    start_instret = get_instret();
+    bf16_add_n(out, a, b, 19);
+    passed = true;
+    for (i = 0; i < 19; i++)
+        if (out[i].bits != bf16_add(a[i], b[i]).bits)
+            passed = false;
+    if (passed) {
+        TEST_LOGGER("  bf16_add_n: PASSED\n");
+    } else {
+        TEST_LOGGER("  bf16_add_n: FAILED\n");
+    }
 
-    test_chacha20();
+    bf16_sub_n(out, a, b, 19);
+    passed = true;
+    for (i = 0; i < 19; i++)
+        if (out[i].bits != bf16_sub(a[i], b[i]).bits)
+            passed = false;
+    if (passed) {
+        TEST_LOGGER("  bf16_sub_n: PASSED\n");
+    } else {
+        TEST_LOGGER("  bf16_sub_n: FAILED\n");
+    }
 
-    end_cycles = get_cycles();
-    end_instret = get_instret();
-    cycles_elapsed = end_cycles - start_cycles;
-    instret_elapsed = end_instret - start_instret;
+    bf16_mul_n(out, a, b, 19);
+    passed = true;
+    for (i = 0; i < 19; i++)
+        if (out[i].bits != bf16_mul(a[i], b[i]).bits)
+            passed = false;
+    if (passed) {
+        TEST_LOGGER("  bf16_mul_n: PASSED\n");
+    } else {
+        TEST_LOGGER("  bf16_mul_n: FAILED\n");
+    }
 
-    TEST_LOGGER("  Cycles: ");
-    print_dec((unsigned long) cycles_elapsed);
-    TEST_LOGGER("  Instructions: ");
-    print_dec((unsigned long) instret_elapsed);
-    TEST_LOGGER("\n");
+    bf16_div_n(out, a, b, 19);
+    passed = true;
+    for (i = 0; i < 19; i++)
+        if (out[i].bits != bf16_div(a[i], b[i]).bits)
+            passed = false;
+    if (passed) {
+        TEST_LOGGER("  bf16_div_n: PASSED\n");
+    } else {
+        TEST_LOGGER("  bf16_div_n: FAILED\n");
+    }
 
-    TEST_LOGGER("\n=== BFloat16 Tests ===\n\n");
+    memcpy(y, b, sizeof(y));
+    bf16_axpy_n(y, alpha, a, 19);
+    passed = true;
+    for (i = 0; i < 19; i++)
+        if (y[i].bits != bf16_add(bf16_mul(alpha, a[i]), b[i]).bits)
+            passed = false;
+    if (passed) {
+        TEST_LOGGER("  bf16_axpy_n: PASSED\n");
+    } else {
+        TEST_LOGGER("  bf16_axpy_n: FAILED\n");
+    }
 
-    /* Test 1: Addition */
-    TEST_LOGGER("Test 1: bf16_add\n");
-    start_cycles = get_cycles();
-    start_instret = get_instret();
+    bf16_scale_n(out, alpha, a, 19);
+    passed = true;
+    for (i = 0; i < 19; i++)
+        if (out[i].bits != bf16_mul(alpha, a[i]).bits)
+            passed = false;
+    if (passed) {
+        TEST_LOGGER("  bf16_scale_n: PASSED\n");
+    } else {
+        TEST_LOGGER("  bf16_scale_n: FAILED\n");
+    }
+}
 
-    test_bf16_add();
+static void test_bf16_mul_table(void)
+{
+    TEST_LOGGER("Test: bf16 mantissa product (BF16_MUL_TABLE=");
+    print_dec_raw(BF16_MUL_TABLE);
+    TEST_LOGGER(")\n");
 
-    end_cycles = get_cycles();
-    end_instret = get_instret();
-    cycles_elapsed = end_cycles - start_cycles;
-    instret_elapsed = end_instret - start_instret;
+    /* Every mantissa pair against the shift-add multiply */
+    bool passed = true;
+    for (uint32_t a = 0x80; a < 0x100; a++)
+        for (uint32_t b = 0x80; b < 0x100; b++)
+            if (bf16_mant_mul(a, b) != umul(a, b))
+                passed = false;
 
-    TEST_LOGGER("  Cycles: ");
-    print_dec((unsigned long) cycles_elapsed);
-    TEST_LOGGER("  Instructions: ");
-    print_dec((unsigned long) instret_elapsed);
-    TEST_LOGGER("\n");
+    if (passed) {
+        TEST_LOGGER("  all 128 x 128 mantissa products: PASSED\n");
+    } else {
+        TEST_LOGGER("  all 128 x 128 mantissa products: FAILED\n");
+    }
+}
 
-    /* Test 2: Subtraction */
-    TEST_LOGGER("Test 2: bf16_sub\n");
-    start_cycles = get_cycles();
-    start_instret = get_instret();
+/* a / b for finite non-zero operands by long division, rounded through
+ * bf16_wide_pack(): the reference for the reciprocal engine.
+ */
+static bf16_t div_long(bf16_t a, bf16_t b)
+{
+    int32_t exp_a, exp_b;
+    uint32_t mant_a = bf16_unpack_mant(a, &exp_a);
+    uint32_t mant_b = bf16_unpack_mant(b, &exp_b);
+    bf16_wide_t q = {
+        .sign = (a.bits ^ b.bits) >> 15,
+        .exp = exp_a - exp_b + BF16_EXP_BIAS,
+    };
 
-    test_bf16_sub();
+    /* 2^21 < quotient < 2^23; the remainder is the sticky bit */
+    uint32_t quotient = udiv(mant_a << 22, mant_b);
+    uint32_t sticky = umod(mant_a << 22, mant_b) != 0;
 
-    end_cycles = get_cycles();
-    end_instret = get_instret();
-    cycles_elapsed = end_cycles - start_cycles;
-    instret_elapsed = end_instret - start_instret;
+    if (quotient & 0x400000) {
+        q.sig = quotient << 8 | sticky;
+    } else {
+        q.sig = quotient << 9 | sticky;
+        q.exp--;
+    }
+    return bf16_wide_pack(q);
+}
 
-    TEST_LOGGER("  Cycles: ");
-    print_dec((unsigned long) cycles_elapsed);
-    TEST_LOGGER("  Instructions: ");
-    print_dec((unsigned long) instret_elapsed);
-    TEST_LOGGER("\n");
+static void test_bf16_div_recip(void)
+{
+    /* Exponent pairs around the normal range, denormal operands, underflow
+     * into the denormals and overflow.
+     */
+    static const uint16_t exps[][2] = {
+        {127, 127}, {2, 127}, {1, 127}, {200, 73},
+        {254, 1},   {0, 127}, {127, 0},
+    };
+    bool passed = true;
 
-    /* Test 3: Multiplication */
-    TEST_LOGGER("Test 3: bf16_mul\n");
-    start_cycles = get_cycles();
-    start_instret = get_instret();
+    TEST_LOGGER("Test: bf16_div reciprocal engine vs long division\n");
+
+    for (size_t e = 0; e < sizeof(exps) / sizeof(exps[0]); e++) {
+        for (uint16_t ma = !exps[e][0]; ma < 0x80; ma++) {
+            for (uint16_t mb = !exps[e][1]; mb < 0x80; mb++) {
+                bf16_t a = {.bits = (exps[e][0] << 7) | ma};
+                bf16_t b = {.bits = 0x8000 | (exps[e][1] << 7) | mb};
+                if (bf16_div(a, b).bits != div_long(a, b).bits)
+                    passed = false;
+            }
+        }
+    }
+
+    if (passed) {
+        TEST_LOGGER("  7 x 128 x 128 operand pairs: PASSED\n");
+    } else {
+        TEST_LOGGER("  7 x 128 x 128 operand pairs: FAILED\n");
+    }
+}
+
+static void test_bf16_sqrt(void)
+{
+    /* Expected values are the exact results rounded to nearest */
+    static const struct {
+        uint16_t in, sqrt, rsqrt;
+    } cases[] = {
+        {0x4080, 0x4000, 0x3F00}, /* 4.0 */
+        {0x4000, 0x3FB5, 0x3F35}, /* 2.0 (odd exponent) */
+        {0x3F80, 0x3F80, 0x3F80}, /* 1.0 */
+        {0x3F00, 0x3F35, 0x3FB5}, /* 0.5 */
+        {0x40E0, 0x4029, 0x3EC2}, /* 7.0: rsqrt rounds up */
+        {0x4049, 0x3FE3, 0x3F10}, /* 3.140625: sqrt rounds up */
+        {0x0001, 0x1E35, 0x60B5}, /* smallest denormal */
+        {0x0080, 0x2000, 0x5F00}, /* smallest normal */
+        {0x0000, 0x0000, 0x7F80}, /* +0 */
+        {0x8000, 0x8000, 0xFF80}, /* -0 */
+        {0x7F80, 0x7F80, 0x0000}, /* +Inf */
+        {0x7FC0, 0x7FC0, 0x7FC0}, /* NaN */
+        {0xBF80, 0x7FC0, 0x7FC0}, /* -1.0 */
+    };
+    bool passed = true;
+
+    TEST_LOGGER("Test: bf16_sqrt / bf16_rsqrt\n");
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        bf16_t x = {.bits = cases[i].in};
+        if (bf16_sqrt(x).bits != cases[i].sqrt ||
+            bf16_rsqrt(x).bits != cases[i].rsqrt) {
+            TEST_LOGGER("  mismatch for input ");
+            print_hex(cases[i].in);
+            passed = false;
+        }
+    }
+
+    if (passed) {
+        TEST_LOGGER("  PASSED\n");
+    } else {
+        TEST_LOGGER("  FAILED\n");
+    }
+}
+
+static void test_bf16_fma(void)
+{
+    static const struct {
+        uint16_t a, b, c, expect;
+    } cases[] = {
+        {0x4000, 0x4040, 0x3F80, 0x40E0}, /* 2 * 3 + 1 = 7 */
+        {0x4000, 0x4040, 0xC0C0, 0x0000}, /* 2 * 3 - 6 = +0 */
+        /* (1 + 2^-7)^2 - (1 + 2^-6) = 2^-14; mul then add rounds it away */
+        {0x3F81, 0x3F81, 0xBF82, 0x3880},
+        {0x3F80, 0x3F80, 0xB580, 0x3F80}, /* 1 - 2^-20 rounds back to 1 */
+        {0x3F80, 0x3F81, 0x3B80, 0x3F82}, /* 1 + 2^-7 + 2^-8: tie to even */
+        {0x7F80, 0x0000, 0x3F80, 0x7FC0}, /* Inf * 0 = NaN */
+        {0x7F80, 0x3F80, 0xFF80, 0x7FC0}, /* Inf - Inf = NaN */
+        {0x3F80, 0x3F80, 0xFF80, 0xFF80}, /* 1 - Inf = -Inf */
+        {0x8000, 0x3F80, 0x8000, 0x8000}, /* -0 * 1 + -0 = -0 */
+    };
+    bool passed = true;
+
+    TEST_LOGGER("Test: bf16_fma / bf16_dot\n");
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        bf16_t r = bf16_fma((bf16_t) {.bits = cases[i].a},
+                            (bf16_t) {.bits = cases[i].b},
+                            (bf16_t) {.bits = cases[i].c});
+        if (r.bits != cases[i].expect) {
+            TEST_LOGGER("  bf16_fma mismatch, got ");
+            print_hex(r.bits);
+            passed = false;
+        }
+    }
+
+    /* 256 + 255 * 1.0: the wide accumulator keeps every 1.0, while a
+     * bf16_mul/bf16_add chain rounds each one away at 256.
+     */
+    static bf16_t a[256], b[256];
+    a[0].bits = 0x4380;
+    b[0].bits = 0x3F80;
+    for (size_t i = 1; i < 256; i++) {
+        a[i].bits = 0x3F80;
+        b[i].bits = 0x3F80;
+    }
+    bf16_t r = bf16_dot(a, b, 256);
+    TEST_LOGGER("  bf16_dot(256 + 255 x 1.0) = ");
+    print_hex(r.bits);
+    if (r.bits != 0x4400) /* 511 is a tie, rounded to even 512 */
+        passed = false;
+
+    if (passed) {
+        TEST_LOGGER("  PASSED\n");
+    } else {
+        TEST_LOGGER("  FAILED\n");
+    }
+}
+
+/* Fill x with n values from an xorshift stream: exponents 120..135, with
+ * an occasional zero or denormal so the packing sees every finite class.
+ */
+static void gemm_test_fill(bf16_t *x, size_t n, uint32_t *seed)
+{
+    for (size_t i = 0; i < n; i++) {
+        uint32_t r = *seed;
+        r ^= r << 13;
+        r ^= r >> 17;
+        r ^= r << 5;
+        *seed = r;
+        if ((r & 0x1F) == 0)
+            x[i].bits = (r >> 16) & 0x807F;
+        else
+            x[i].bits = (r & 0x807F) | ((120 + (r >> 8 & 0xF)) << 7);
+    }
+}
+
+static void test_bf16_gemm(void)
+{
+    /* straddling the 2x4 tile and the MC / NC / KC blocks */
+    static const struct {
+        uint16_t m, n, k;
+    } shapes[] = {
+        {1, 1, 1}, {2, 4, 3}, {5, 7, 9}, {3, 5, 300}, {33, 65, 2},
+    };
+    static bf16_t a[1024], b[2048], c[2304];
+    uint32_t seed = 0x9E3779B9;
+    bool passed = true;
+
+    TEST_LOGGER("Test: bf16_gemm\n");
+
+    for (size_t s = 0; s < sizeof(shapes) / sizeof(shapes[0]); s++) {
+        size_t m = shapes[s].m, n = shapes[s].n, k = shapes[s].k;
+
+        gemm_test_fill(a, m * k, &seed);
+        gemm_test_fill(b, k * n, &seed);
+        bf16_gemm(m, n, k, a, k, b, n, c, n);
+        for (size_t i = 0; i < m; i++)
+            for (size_t j = 0; j < n; j++)
+                if (c[i * n + j].bits !=
+                    bf16_dot_stride(a + i * k, 1, b + j, n, k).bits)
+                    passed = false;
+    }
+    if (passed) {
+        TEST_LOGGER("  random shapes vs bf16_dot: PASSED\n");
+    } else {
+        TEST_LOGGER("  random shapes vs bf16_dot: FAILED\n");
+    }
+
+    /* identity * B, with row strides wider than the matrices */
+    static const bf16_t eye[3 * 4] = {
+        {0x3F80}, {0x0000}, {0x0000}, {0x0000},
+        {0x0000}, {0x3F80}, {0x0000}, {0x0000},
+        {0x0000}, {0x0000}, {0x3F80}, {0x0000},
+    };
+    static const bf16_t rhs[3 * 6] = {
+        {0x4049}, {0xC0A0}, {0x0001}, {0x3DCC}, {0x0000}, {0x0000},
+        {0x8000}, {0x7F7F}, {0x3F81}, {0x0080}, {0x0000}, {0x0000},
+        {0x42C8}, {0x8040}, {0xBF80}, {0x4000}, {0x0000}, {0x0000},
+    };
+    bf16_t out[3 * 5];
+    bool eye_ok = true;
+    bf16_gemm(3, 4, 3, eye, 4, rhs, 6, out, 5);
+    for (size_t i = 0; i < 3; i++)
+        for (size_t j = 0; j < 4; j++)
+            /* -0 * 1 sums to +0 */
+            if (out[i * 5 + j].bits != (rhs[i * 6 + j].bits == 0x8000
+                                             ? 0x0000
+                                             : rhs[i * 6 + j].bits))
+                eye_ok = false;
+    if (eye_ok) {
+        TEST_LOGGER("  identity: PASSED\n");
+    } else {
+        TEST_LOGGER("  identity: FAILED\n");
+    }
+
+    /* a NaN or Inf operand takes the scalar path */
+    a[0].bits = 0x7F80;
+    a[4].bits = 0x7FC0;
+    gemm_test_fill(b, 4 * 4, &seed);
+    bf16_gemm(2, 4, 4, a, 4, b, 4, c, 4);
+    bool special_ok = true;
+    for (size_t i = 0; i < 2; i++)
+        for (size_t j = 0; j < 4; j++)
+            if (c[i * 4 + j].bits !=
+                bf16_dot_stride(a + i * 4, 1, b + j, 4, 4).bits)
+                special_ok = false;
+    if (special_ok) {
+        TEST_LOGGER("  Inf / NaN operands: PASSED\n");
+    } else {
+        TEST_LOGGER("  Inf / NaN operands: FAILED\n");
+    }
+
+    if (passed && eye_ok && special_ok) {
+        TEST_LOGGER("  PASSED\n");
+    } else {
+        TEST_LOGGER("  FAILED\n");
+    }
+}
+
+static void test_bf16_asm(void)
+{
+    /* every special class, the normal/denormal boundary and near-overflow */
+    static const uint16_t vals[] = {
+        0x0000, 0x8000, 0x0001, 0x807F, 0x0040, 0x0080, 0x8081, 0x7F7F,
+        0xFF7F, 0x7F80, 0xFF80, 0x7FC0, 0x7F81, 0x3F80, 0xBF80, 0x3F81,
+        0x4000, 0x0100, 0x4049, 0xC0A0, 0x3DCC, 0x42C8, 0x0380, 0x3C00,
+    };
+    const size_t n = sizeof(vals) / sizeof(vals[0]);
+    bool add_ok = true, sub_ok = true, mul_ok = true;
+
+    TEST_LOGGER("Test: bf16 assembly ops vs C\n");
+
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < n; j++) {
+            bf16_t a = {.bits = vals[i]}, b = {.bits = vals[j]};
+            if (bf16_add_asm(a, b).bits != bf16_add(a, b).bits)
+                add_ok = false;
+            if (bf16_sub_asm(a, b).bits != bf16_sub(a, b).bits)
+                sub_ok = false;
+            if (bf16_mul_asm(a, b).bits != bf16_mul(a, b).bits)
+                mul_ok = false;
+        }
+    }
+
+    if (add_ok) {
+        TEST_LOGGER("  bf16_add_asm: PASSED\n");
+    } else {
+        TEST_LOGGER("  bf16_add_asm: FAILED\n");
+    }
+    if (sub_ok) {
+        TEST_LOGGER("  bf16_sub_asm: PASSED\n");
+    } else {
+        TEST_LOGGER("  bf16_sub_asm: FAILED\n");
+    }
+    if (mul_ok) {
+        TEST_LOGGER("  bf16_mul_asm: PASSED\n");
+    } else {
+        TEST_LOGGER("  bf16_mul_asm: FAILED\n");
+    }
+}
+
+static void test_bf16x2(void)
+{
+    /* special classes, denormals, and normal pairs whose product
+     * overflows or underflows
+     */
+    static const uint16_t vals[] = {
+        0x0000, 0x8000, 0x0001, 0x807F, 0x0080, 0x8081, 0x7F7F, 0xFF7F,
+        0x7F80, 0xFF80, 0x7FC0, 0x7F81, 0x3F80, 0xBF80, 0x3F81, 0x4000,
+        0x4049, 0xC0A0, 0x3DCC, 0x42C8, 0x0380, 0x3C00, 0x5F80, 0x2000,
+    };
+    const size_t n = sizeof(vals) / sizeof(vals[0]);
+    bool arith_ok = true, cmp_ok = true, sign_ok = true, mem_ok = true;
+
+    TEST_LOGGER("Test: bf16x2 packed ops vs scalar\n");
+
+    /* the low lane gets (x, y), the high lane (y, x) */
+    for (size_t i = 0; i < n; i++) {
+        for (size_t j = 0; j < n; j++) {
+            bf16_t x = {.bits = vals[i]}, y = {.bits = vals[j]};
+            bf16x2_t a = bf16x2_pack(x, y), b = bf16x2_pack(y, x);
+            bf16x2_t r;
+
+            r = bf16x2_add(a, b);
+            if (r.bits != bf16x2_pack(bf16_add(x, y), bf16_add(y, x)).bits)
+                arith_ok = false;
+            r = bf16x2_sub(a, b);
+            if (r.bits != bf16x2_pack(bf16_sub(x, y), bf16_sub(y, x)).bits)
+                arith_ok = false;
+            r = bf16x2_mul(a, b);
+            if (r.bits != bf16x2_pack(bf16_mul(x, y), bf16_mul(y, x)).bits)
+                arith_ok = false;
+
+            if (bf16x2_eq(a, b) != ((bf16_eq(x, y) ? 0xFFFFU : 0) |
+                                    (bf16_eq(y, x) ? 0xFFFF0000U : 0)))
+                cmp_ok = false;
+            if (bf16x2_lt(a, b) != ((bf16_lt(x, y) ? 0xFFFFU : 0) |
+                                    (bf16_lt(y, x) ? 0xFFFF0000U : 0)))
+                cmp_ok = false;
+            if (bf16x2_le(a, b) != ((bf16_le(x, y) ? 0xFFFFU : 0) |
+                                    (bf16_le(y, x) ? 0xFFFF0000U : 0)))
+                cmp_ok = false;
+        }
+
+        bf16x2_t a = bf16x2_pack((bf16_t) {.bits = vals[i]},
+                                 (bf16_t) {.bits = vals[n - 1 - i]});
+        if (bf16x2_neg(a).bits != (a.bits ^ 0x80008000U) ||
+            bf16x2_abs(a).bits != (a.bits & 0x7FFF7FFFU))
+            sign_ok = false;
+    }
+
+    /* word and half-word paths of load / store */
+    static bf16_t buf[6];
+    for (size_t i = 0; i < 6; i++)
+        buf[i].bits = vals[i + 12];
+    for (size_t i = 0; i < 4; i++) {
+        bf16x2_t x = bf16x2_load(buf + i);
+        if (x.bits != bf16x2_pack(buf[i], buf[i + 1]).bits)
+            mem_ok = false;
+        bf16x2_store(buf + i, bf16x2_neg(x));
+        bf16x2_store(buf + i, bf16x2_neg(bf16x2_load(buf + i)));
+        if (bf16x2_load(buf + i).bits != x.bits)
+            mem_ok = false;
+    }
+
+    if (arith_ok) {
+        TEST_LOGGER("  add / sub / mul: PASSED\n");
+    } else {
+        TEST_LOGGER("  add / sub / mul: FAILED\n");
+    }
+    if (cmp_ok) {
+        TEST_LOGGER("  eq / lt / le: PASSED\n");
+    } else {
+        TEST_LOGGER("  eq / lt / le: FAILED\n");
+    }
+    if (sign_ok) {
+        TEST_LOGGER("  neg / abs: PASSED\n");
+    } else {
+        TEST_LOGGER("  neg / abs: FAILED\n");
+    }
+    if (mem_ok) {
+        TEST_LOGGER("  load / store: PASSED\n");
+    } else {
+        TEST_LOGGER("  load / store: FAILED\n");
+    }
+}
+
+static void test_bf16_math(void)
+{
+    /* Expected values are the exact results rounded to nearest */
+    static const struct {
+        uint16_t in, exp, log, sigmoid, tanh, gelu;
+    } cases[] = {
+        {0x0000, 0x3F80, 0xFF80, 0x3F00, 0x0000, 0x0000}, /* +0 */
+        {0x8000, 0x3F80, 0xFF80, 0x3F00, 0x8000, 0x8000}, /* -0 */
+        {0x3F80, 0x402E, 0x0000, 0x3F3B, 0x3F43, 0x3F57}, /* 1.0 */
+        {0xBF80, 0x3EBC, 0x7FC0, 0x3E8A, 0xBF43, 0xBE23}, /* -1.0 */
+        {0x3F00, 0x3FD3, 0xBF31, 0x3F1F, 0x3EED, 0x3EB1}, /* 0.5 */
+        {0x4049, 0x41B9, 0x3F92, 0x3F75, 0x3F7F, 0x4049}, /* 3.140625 */
+        {0xC0A0, 0x3BDD, 0x7FC0, 0x3BDB, 0xBF80, 0xB476}, /* -5.0 */
+        {0x42C8, 0x7F80, 0x4093, 0x3F80, 0x3F80, 0x42C8}, /* 100: exp overflows */
+        {0xC2C8, 0x0000, 0x7FC0, 0x0000, 0xBF80, 0x8000}, /* -100 */
+        {0x3C00, 0x3F81, 0xC09B, 0x3F00, 0x3C00, 0x3B81}, /* 2^-7 */
+        {0x0001, 0x3F80, 0xC2B8, 0x3F00, 0x0001, 0x0000}, /* smallest denormal */
+        {0x7F80, 0x7F80, 0x7F80, 0x3F80, 0x3F80, 0x7F80}, /* +Inf */
+        {0xFF80, 0x0000, 0x7FC0, 0x0000, 0xBF80, 0x8000}, /* -Inf */
+        {0x7FC0, 0x7FC0, 0x7FC0, 0x7FC0, 0x7FC0, 0x7FC0}, /* NaN */
+    };
+    bool passed = true;
+
+    TEST_LOGGER("Test: bf16_exp / log / sigmoid / tanh / gelu\n");
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        bf16_t x = {.bits = cases[i].in};
+        if (bf16_exp(x).bits != cases[i].exp ||
+            bf16_log(x).bits != cases[i].log ||
+            bf16_sigmoid(x).bits != cases[i].sigmoid ||
+            bf16_tanh(x).bits != cases[i].tanh ||
+            bf16_gelu(x).bits != cases[i].gelu) {
+            TEST_LOGGER("  mismatch for input ");
+            print_hex(cases[i].in);
+            passed = false;
+        }
+    }
+
+    /* tanh is odd by construction, on both sides of the series cutoff */
+    for (uint32_t bits = 0x3C00; bits < 0x4100; bits++) {
+        bf16_t x = {.bits = bits}, nx = {.bits = bits | 0x8000};
+        if (bf16_tanh(nx).bits != (bf16_tanh(x).bits | 0x8000))
+            passed = false;
+    }
+
+    if (passed) {
+        TEST_LOGGER("  PASSED\n");
+    } else {
+        TEST_LOGGER("  FAILED\n");
+    }
+}
+
+/* A zero-exponent value as the finite ops see it: a signed zero */
+static bf16_t flush_denorm(bf16_t x)
+{
+    if (!(x.bits & BF16_EXP_MASK))
+        x.bits &= BF16_SIGN_MASK;
+    return x;
+}
+
+static void test_bf16_finite(void)
+{
+    static const uint16_t vals[] = {
+        0x3F80, 0xBF80, 0x4049, 0xC0A0, 0x0080, 0x8081, 0x7F7F, 0xFF7F,
+        0x0001, 0x807F, 0x0000, 0x8000,
+    };
+    bool passed = true;
+
+    TEST_LOGGER("Test: bf16 finite-math variants vs full ops\n");
+
+    /* b sweeps every exponent; the contract is the full op on flushed
+     * operands with the result flushed, and x / 0 = Inf even for 0 / 0
+     */
+    for (size_t i = 0; i < sizeof(vals) / sizeof(vals[0]); i++) {
+        for (uint32_t k = 0; k < 256; k++) {
+            bf16_t a = {.bits = vals[i]};
+            bf16_t b = {.bits = (k << 8) | (k ^ 0x5A)};
+            if ((b.bits & BF16_EXP_MASK) == BF16_EXP_MASK)
+                continue;
+            bf16_t fa = flush_denorm(a), fb = flush_denorm(b);
+            bf16_t q = flush_denorm(bf16_div(fa, fb));
+
+            if (bf16_iszero(fa) && bf16_iszero(fb))
+                q.bits = ((a.bits ^ b.bits) & BF16_SIGN_MASK) | 0x7F80;
+            if (bf16_add_finite(a, b).bits != flush_denorm(bf16_add(fa, fb)).bits ||
+                bf16_sub_finite(a, b).bits != flush_denorm(bf16_sub(fa, fb)).bits ||
+                bf16_mul_finite(a, b).bits != flush_denorm(bf16_mul(fa, fb)).bits ||
+                bf16_div_finite(a, b).bits != q.bits) {
+                TEST_LOGGER("  mismatch for ");
+                print_hex(a.bits);
+                TEST_LOGGER("           and ");
+                print_hex(b.bits);
+                passed = false;
+            }
+        }
+    }
+
+    if (passed) {
+        TEST_LOGGER("  12 x 256 operand pairs: PASSED\n");
+    } else {
+        TEST_LOGGER("  12 x 256 operand pairs: FAILED\n");
+    }
+}
+
+/* Shell sort on bf16_key(), Ciura's gaps: the comparison sort that
+ * bf16_sort_n is measured against
+ */
+static void shell_sort_bf16(bf16_t *a, size_t n)
+{
+    static const uint16_t gaps[] = {1750, 701, 301, 132, 57, 23, 10, 4, 1};
+
+    for (size_t g = 0; g < sizeof(gaps) / sizeof(gaps[0]); g++) {
+        size_t gap = gaps[g];
+        for (size_t i = gap; i < n; i++) {
+            bf16_t x = a[i];
+            uint16_t k = bf16_key(x);
+            size_t j = i;
+            for (; j >= gap && bf16_key(a[j - gap]) > k; j -= gap)
+                a[j] = a[j - gap];
+            a[j] = x;
+        }
+    }
+}
+
+static void test_bf16_sort(void)
+{
+    /* every class, both zeros twice to see the order kept */
+    static const uint16_t vals[] = {
+        0x8000, 0x0000, 0x7FC0, 0xFFC0, 0x7F80, 0xFF80, 0x0001, 0x807F,
+        0x3F80, 0xBF80, 0x4049, 0xC0A0, 0x7F7F, 0xFF7F, 0x0000, 0x8000,
+    };
+    static bf16_t a[64], tmp[64];
+    uint32_t sum = 0, xor = 0;
+    bool key_ok = true, minmax_ok = true, sort_ok = true;
+
+    TEST_LOGGER("Test: bf16_key / bf16_min / bf16_max / bf16_sort_n\n");
+
+    /* the key follows every non-NaN value up through the positive range
+     * and down through the negative one
+     */
+    for (uint32_t bits = 1; bits < 0x7F81; bits++) {
+        if (bf16_key((bf16_t) {.bits = bits}) <=
+                bf16_key((bf16_t) {.bits = bits - 1}) ||
+            bf16_key((bf16_t) {.bits = bits | 0x8000}) >=
+                bf16_key((bf16_t) {.bits = (bits - 1) | 0x8000}))
+            key_ok = false;
+    }
+    if (bf16_key((bf16_t) {.bits = 0x8000}) != bf16_key(BF16_ZERO()))
+        key_ok = false;
+
+    for (size_t i = 0; i < 16; i++) {
+        for (size_t j = 0; j < 16; j++) {
+            bf16_t x = {.bits = vals[i]}, y = {.bits = vals[j]};
+            bf16_t lo = bf16_min(x, y), hi = bf16_max(x, y);
+            if (bf16_isnan(x) && bf16_isnan(y))
+                continue;
+            if (bf16_isnan(lo) || bf16_isnan(hi) || bf16_lt(hi, lo) ||
+                (lo.bits != x.bits && lo.bits != y.bits) ||
+                (hi.bits != x.bits && hi.bits != y.bits))
+                minmax_ok = false;
+        }
+    }
+
+    /* the list four times, the later copies with mantissa bits flipped */
+    for (size_t i = 0; i < 64; i++) {
+        a[i].bits = vals[i & 15] ^ (i < 16 ? 0 : i);
+        sum += a[i].bits;
+        xor ^= a[i].bits;
+    }
+    bf16_sort_n(a, tmp, 64);
+
+    for (size_t i = 0; i < 64; i++) {
+        sum -= a[i].bits;
+        xor ^= a[i].bits;
+        if (i && bf16_key(a[i]) < bf16_key(a[i - 1]))
+            sort_ok = false;
+    }
+    if (sum || xor)
+        sort_ok = false;
+    /* the zeros of vals[] in input order: -0, +0, +0, -0 */
+    for (size_t i = 0; i < 64; i++) {
+        if (bf16_iszero(a[i])) {
+            if (a[i].bits != 0x8000 || a[i + 1].bits != 0x0000 ||
+                a[i + 2].bits != 0x0000 || a[i + 3].bits != 0x8000)
+                sort_ok = false;
+            break;
+        }
+    }
+
+    if (key_ok) {
+        TEST_LOGGER("  bf16_key monotonic: PASSED\n");
+    } else {
+        TEST_LOGGER("  bf16_key monotonic: FAILED\n");
+    }
+    if (minmax_ok) {
+        TEST_LOGGER("  bf16_min / bf16_max: PASSED\n");
+    } else {
+        TEST_LOGGER("  bf16_min / bf16_max: FAILED\n");
+    }
+    if (sort_ok) {
+        TEST_LOGGER("  bf16_sort_n: PASSED\n");
+    } else {
+        TEST_LOGGER("  bf16_sort_n: FAILED\n");
+    }
+}
+
+static void test_f32_convert(void)
+{
+    static const struct {
+        uint32_t f;
+        uint16_t expect;
+    } cases[] = {
+        {0x3F800000, 0x3F80}, /* 1.0 */
+        {0x3F808000, 0x3F80}, /* tie, even stays */
+        {0x3F818000, 0x3F82}, /* tie, odd rounds up */
+        {0x3F808001, 0x3F81}, /* just above the tie */
+        {0xBF80FFFF, 0xBF81}, /* negative rounds by magnitude */
+        {0x7F7F7FFF, 0x7F7F}, /* largest value that stays finite */
+        {0x7F7FFFFF, 0x7F80}, /* FLT_MAX rounds to Inf */
+        {0x7F800000, 0x7F80}, /* Inf */
+        {0xFF800000, 0xFF80}, /* -Inf */
+        {0x7FC00000, 0x7FC0}, /* quiet NaN */
+        {0x7F800001, 0x7FC0}, /* NaN with its payload in the low half */
+        {0xFFFFFFFF, 0xFFFF}, /* NaN that must not carry into the sign */
+        {0x00008000, 0x0000}, /* denormal tie to even */
+        {0x00018000, 0x0002}, /* denormal tie to even */
+        {0x007FFFFF, 0x0080}, /* largest denormal up to smallest normal */
+        {0x80000000, 0x8000}, /* -0 */
+    };
+    static uint32_t f[1000];
+    static bf16_t b[1000];
+    bool scalar_ok = true, trip_ok = true;
+
+    TEST_LOGGER("Test: f32_to_bf16 / bf16_to_f32\n");
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        if (f32_to_bf16(cases[i].f).bits != cases[i].expect) {
+            TEST_LOGGER("  mismatch for input ");
+            print_hex(cases[i].f);
+            scalar_ok = false;
+        }
+    }
+
+    /* every bf16 through float32 and back, in chunks that leave a tail;
+     * only a signaling NaN changes, by being quieted
+     */
+    for (uint32_t base = 0; base < 0x10000; base += 1000) {
+        size_t n = 0x10000 - base < 1000 ? 0x10000 - base : 1000;
+        for (size_t i = 0; i < n; i++)
+            b[i].bits = base + i;
+        bf16_to_f32_n(f, b, n);
+        for (size_t i = 0; i < n; i++)
+            if (f[i] != (base + i) << 16)
+                trip_ok = false;
+        f32_to_bf16_n(b, f, n);
+        for (size_t i = 0; i < n; i++)
+            if (b[i].bits != (bf16_isnan(b[i]) ? (base + i) | 0x40 : base + i))
+                trip_ok = false;
+    }
+
+    if (scalar_ok) {
+        TEST_LOGGER("  rounding cases: PASSED\n");
+    } else {
+        TEST_LOGGER("  rounding cases: FAILED\n");
+    }
+    if (trip_ok) {
+        TEST_LOGGER("  all 65536 values round trip: PASSED\n");
+    } else {
+        TEST_LOGGER("  all 65536 values round trip: FAILED\n");
+    }
+}
+
+/* Rotate-and-xor over the output bit patterns: any changed bit of any
+ * output changes the sum
+ */
+static uint32_t mlp_checksum(const bf16_t *y, size_t n)
+{
+    uint32_t sum = 0;
+
+    for (size_t i = 0; i < n; i++)
+        sum = ((sum << 5) | (sum >> 27)) ^ y[i].bits;
+    return sum;
+}
+
+/* checksum of the outputs for bf16_mlp_input; every output was checked
+ * against the exact dot products rounded per layer
+ */
+#define MLP_EXPECT_CHECKSUM 0x4E9BDDF6U
+
+static void test_bf16_mlp(void)
+{
+    /* rows (1, 2, 3) and (-1, -1, -1), bias 0.5, x = (1, 1, 1) */
+    static const bf16_t w[6] = {{0x3F80}, {0x4000}, {0x4040},
+                                {0xBF80}, {0xBF80}, {0xBF80}};
+    static const bf16_t bias[2] = {{0x3F00}, {0x3F00}};
+    static const bf16_t ones[3] = {{0x3F80}, {0x3F80}, {0x3F80}};
+    static bf16_t out[BF16_MLP_BATCH * BF16_MLP_OUT];
+    bf16_t y[2];
+    bool layer_ok = true, finite_ok = true;
+
+    TEST_LOGGER("Test: bf16_mlp_layer / bf16_mlp_forward\n");
+
+    /* 6.5 and -2.5, the second clamped by the ReLU */
+    bf16_mlp_layer(y, w, bias, ones, 2, 3, false);
+    if (y[0].bits != 0x40D0 || y[1].bits != 0xC020)
+        layer_ok = false;
+    bf16_mlp_layer(y, w, bias, ones, 2, 3, true);
+    if (y[0].bits != 0x40D0 || y[1].bits != 0x0000)
+        layer_ok = false;
+
+    /* a NaN input stays NaN through the ReLU */
+    bf16_t x_nan[3] = {BF16_NAN(), {0x3F80}, {0x3F80}};
+    bf16_mlp_layer(y, w, bias, x_nan, 2, 3, true);
+    if (!bf16_isnan(y[0]) || !bf16_isnan(y[1]))
+        layer_ok = false;
+
+    for (size_t b = 0; b < BF16_MLP_BATCH; b++)
+        bf16_mlp_forward(out + b * BF16_MLP_OUT,
+                         bf16_mlp_input + b * BF16_MLP_IN);
+    for (size_t i = 0; i < BF16_MLP_BATCH * BF16_MLP_OUT; i++)
+        if (bf16_isnan(out[i]) || bf16_isinf(out[i]))
+            finite_ok = false;
+    uint32_t sum = mlp_checksum(out, BF16_MLP_BATCH * BF16_MLP_OUT);
+
+    if (layer_ok) {
+        TEST_LOGGER("  layer bias and ReLU: PASSED\n");
+    } else {
+        TEST_LOGGER("  layer bias and ReLU: FAILED\n");
+    }
+    if (finite_ok && sum == MLP_EXPECT_CHECKSUM) {
+        TEST_LOGGER("  forward pass checksum: PASSED\n");
+    } else {
+        TEST_LOGGER("  forward pass checksum: FAILED, got 0x");
+        print_hex(sum);
+    }
+}
+
+static void test_bf16_reduce(void)
+{
+    static bf16_t a[4096];
+    static const struct {
+        uint16_t a[4];
+        uint8_t n;
+        uint16_t sum, norm;
+    } cases[] = {
+        {{0x4040, 0x4080}, 2, 0x40E0, 0x40A0},         /* 3, 4: norm 5 */
+        {{0x4980, 0x3F80, 0xC980}, 3, 0x3F80, 0x49B5}, /* 2^20 + 1 - 2^20 */
+        {{0x7180, 0x7180}, 2, 0x7200, 0x71B5},         /* squares past Inf */
+        {{0x0D80, 0x0D80, 0x0D80, 0x0D80}, 4, 0x0E80, 0x0E00}, /* 2^-100 */
+        {{0x3F80, 0x7F80}, 2, 0x7F80, 0x7F80},         /* 1, Inf */
+        {{0x7F80, 0xFF80}, 2, 0x7FC0, 0x7F80},         /* Inf, -Inf */
+        {{0xFF80, 0x7FC0}, 2, 0x7FC0, 0x7FC0},         /* -Inf, NaN */
+        {{0x8000, 0x0000}, 0, 0x0000, 0x0000},         /* empty */
+    };
+    static const bf16_t vals[7] = {{0x7FC0}, {0xBF80}, {0x8000}, {0x0000},
+                                   {0x3F80}, {0xFFC0}, {0x3F80}};
+    static const bf16_t zeros[2] = {{0x8000}, {0x0000}};
+    static const bf16_t nans[2] = {{0x7FC0}, {0xFFC0}};
+    bool sum_ok = true, max_ok = true;
+
+    TEST_LOGGER("Test: bf16_sum_n / bf16_norm2_n / bf16_max_n / bf16_argmax_n\n");
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        const bf16_t *x = (const bf16_t *) cases[i].a;
+        if (bf16_sum_n(x, cases[i].n).bits != cases[i].sum ||
+            bf16_norm2_n(x, cases[i].n).bits != cases[i].norm) {
+            TEST_LOGGER("  mismatch for case ");
+            print_dec(i);
+            sum_ok = false;
+        }
+    }
+
+    /* 4096 ones: a bf16_add chain stops at 256, the wide sum does not;
+     * the norm is 64
+     */
+    for (size_t i = 0; i < 4096; i++)
+        a[i] = bf16_one;
+    if (bf16_sum_n(a, 4096).bits != 0x4580 ||
+        bf16_norm2_n(a, 4096).bits != 0x4280)
+        sum_ok = false;
+    /* 1 + 512 x 2^-9: every term is half a unit of the chain's 1, which
+     * ties to even and stays 1; the exact sum is 2
+     */
+    for (size_t i = 1; i <= 512; i++)
+        a[i].bits = 0x3B00;
+    if (bf16_sum_n(a, 513).bits != 0x4000)
+        sum_ok = false;
+
+    /* NaNs skipped, first of the two ones; -0 and +0 tie */
+    if (bf16_argmax_n(vals, 7) != 4 || bf16_max_n(vals, 7).bits != 0x3F80)
+        max_ok = false;
+    if (bf16_argmax_n(zeros, 2) != 0 || bf16_max_n(zeros, 2).bits != 0x8000)
+        max_ok = false;
+    if (bf16_argmax_n(nans, 2) != 2 || !bf16_isnan(bf16_max_n(nans, 2)))
+        max_ok = false;
+    if (bf16_argmax_n(nans, 0) != 0 || bf16_max_n(nans, 0).bits != 0xFF80)
+        max_ok = false;
+    /* -Inf is a number */
+    a[0].bits = 0xFF80;
+    if (bf16_argmax_n(a, 1) != 0)
+        max_ok = false;
+
+    if (sum_ok) {
+        TEST_LOGGER("  bf16_sum_n / bf16_norm2_n: PASSED\n");
+    } else {
+        TEST_LOGGER("  bf16_sum_n / bf16_norm2_n: FAILED\n");
+    }
+    if (max_ok) {
+        TEST_LOGGER("  bf16_max_n / bf16_argmax_n: PASSED\n");
+    } else {
+        TEST_LOGGER("  bf16_max_n / bf16_argmax_n: FAILED\n");
+    }
+}
+
+/* ============= Benchmarks ============= */
+
+#define BENCH_MAX_N 65536
+
+/* word aligned for the bf16x2 loads */
+static bf16_t bench_a[BENCH_MAX_N] __attribute__((aligned(4)));
+static bf16_t bench_b[BENCH_MAX_N] __attribute__((aligned(4)));
+static bf16_t bench_y[BENCH_MAX_N] __attribute__((aligned(4)));
+
+#define BENCH_TIME(cycles, instret, stmt)  \
+    do {                                   \
+        uint64_t _c0 = get_cycles();       \
+        uint64_t _i0 = get_instret();      \
+        stmt;                              \
+        cycles = get_cycles() - _c0;       \
+        instret = get_instret() - _i0;     \
+    } while (0)
+
+static uint32_t bench_seed = 0x2545F491;
+
+/* xorshift32: only shifts and xors, so it does not go through __mulsi3 */
+static uint32_t bench_rand(void)
+{
+    uint32_t x = bench_seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    bench_seed = x;
+    return x;
+}
+
+/* Random normal value with exponent in [112, 143] (about 2^-15 .. 2^16),
+ * so products and quotients of two of them stay normal.
+ */
+static bf16_t bench_rand_bf16(void)
+{
+    uint32_t r = bench_rand();
+    return (bf16_t) {.bits = (r & 0x807F) | ((112 + (r >> 16 & 0x1F)) << 7)};
+}
+
+/* Print "<cycles> cyc/elem (<instret> inst)" for a run over n elements */
+static void bench_print_per_elem(uint64_t cycles,
+                                 uint64_t instret,
+                                 unsigned long n)
+{
+    print_dec_raw(udiv((unsigned long) cycles, n));
+    TEST_LOGGER(" cyc/elem (");
+    print_dec_raw(udiv((unsigned long) instret, n));
+    TEST_LOGGER(" inst)");
+}
+
+static void bench_print_row(uint64_t scalar_cycles,
+                            uint64_t scalar_instret,
+                            uint64_t array_cycles,
+                            uint64_t array_instret,
+                            unsigned long n)
+{
+    TEST_LOGGER("scalar ");
+    bench_print_per_elem(scalar_cycles, scalar_instret, n);
+    TEST_LOGGER(" | array ");
+    bench_print_per_elem(array_cycles, array_instret, n);
+    TEST_LOGGER("\n");
+}
+
+static void bench_init(void)
+{
+    for (unsigned long i = 0; i < BENCH_MAX_N; i++) {
+        bench_a[i] = bench_rand_bf16();
+        bench_b[i] = bench_rand_bf16();
+    }
+}
+
+static void bench_bf16_array(void)
+{
+    static const unsigned long sizes[] = {16, 64, 256, 1024, 4096, 16384, 65536};
+    const bf16_t alpha = {.bits = 0x3FC0}; /* 1.5 */
+    uint64_t sc, si, ac, ai;
+    unsigned long n, i;
+
+    TEST_LOGGER("Benchmark: bf16 array kernels vs scalar loop\n");
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        n = sizes[s];
+        TEST_LOGGER("  n = ");
+        print_dec(n);
+
+        TEST_LOGGER("    add:   ");
+        BENCH_TIME(sc, si, for (i = 0; i < n; i++) bench_y[i] =
+                               bf16_add(bench_a[i], bench_b[i]));
+        BENCH_TIME(ac, ai, bf16_add_n(bench_y, bench_a, bench_b, n));
+        bench_print_row(sc, si, ac, ai, n);
+
+        TEST_LOGGER("    mul:   ");
+        BENCH_TIME(sc, si, for (i = 0; i < n; i++) bench_y[i] =
+                               bf16_mul(bench_a[i], bench_b[i]));
+        BENCH_TIME(ac, ai, bf16_mul_n(bench_y, bench_a, bench_b, n));
+        bench_print_row(sc, si, ac, ai, n);
+
+        TEST_LOGGER("    div:   ");
+        BENCH_TIME(sc, si, for (i = 0; i < n; i++) bench_y[i] =
+                               bf16_div(bench_a[i], bench_b[i]));
+        BENCH_TIME(ac, ai, bf16_div_n(bench_y, bench_a, bench_b, n));
+        bench_print_row(sc, si, ac, ai, n);
+
+        TEST_LOGGER("    scale: ");
+        BENCH_TIME(sc, si, for (i = 0; i < n; i++) bench_y[i] =
+                               bf16_mul(alpha, bench_a[i]));
+        BENCH_TIME(ac, ai, bf16_scale_n(bench_y, alpha, bench_a, n));
+        bench_print_row(sc, si, ac, ai, n);
+
+        TEST_LOGGER("    axpy:  ");
+        memcpy(bench_y, bench_b, n * sizeof(bf16_t));
+        BENCH_TIME(sc, si, for (i = 0; i < n; i++) bench_y[i] = bf16_add(
+                               bf16_mul(alpha, bench_a[i]), bench_y[i]));
+        memcpy(bench_y, bench_b, n * sizeof(bf16_t));
+        BENCH_TIME(ac, ai, bf16_axpy_n(bench_y, alpha, bench_a, n));
+        bench_print_row(sc, si, ac, ai, n);
+    }
+}
+
+/* Sum of all 128 x 128 mantissa products, one way or the other */
+static uint32_t mant_products_shift_add(void)
+{
+    uint32_t sum = 0;
+    for (uint32_t a = 0x80; a < 0x100; a++)
+        for (uint32_t b = 0x80; b < 0x100; b++)
+            sum += __mulsi3(a, b);
+    return sum;
+}
+
+static uint32_t mant_products_table(void)
+{
+    uint32_t sum = 0;
+    for (uint32_t a = 0x80; a < 0x100; a++)
+        for (uint32_t b = 0x80; b < 0x100; b++)
+            sum += bf16_mant_mul(a, b);
+    return sum;
+}
+
+static void bench_bf16_mul_table(void)
+{
+    volatile uint32_t sink;
+    uint64_t sc, si, tc, ti;
+    unsigned long i;
+
+    TEST_LOGGER("Benchmark: bf16 mantissa product, shift-add vs BF16_MUL_TABLE=");
+    print_dec_raw(BF16_MUL_TABLE);
+    TEST_LOGGER("\n");
+
+    BENCH_TIME(sc, si, sink = mant_products_shift_add());
+    BENCH_TIME(tc, ti, sink = mant_products_table());
+    (void) sink;
+
+    TEST_LOGGER("  shift-add: ");
+    bench_print_per_elem(sc, si, 16384);
+    TEST_LOGGER("\n  table:     ");
+    bench_print_per_elem(tc, ti, 16384);
+    TEST_LOGGER("\n  saved per bf16_mul: ");
+    print_dec_raw(sc > tc ? udiv((unsigned long) (sc - tc), 16384) : 0);
+    TEST_LOGGER(" cycles\n");
+
+    /* Whole bf16_mul over the random operands, for scale */
+    BENCH_TIME(tc, ti, for (i = 0; i < 4096; i++) bench_y[i] =
+                           bf16_mul(bench_a[i], bench_b[i]));
+    TEST_LOGGER("  bf16_mul:  ");
+    bench_print_per_elem(tc, ti, 4096);
+    TEST_LOGGER("\n");
+}
+
+static void bench_bf16_div_recip(void)
+{
+    uint64_t rc, ri, tc, ti;
+    unsigned long i;
+
+    TEST_LOGGER("Benchmark: bf16_div, long division vs reciprocal table\n");
+
+    BENCH_TIME(rc, ri, for (i = 0; i < 4096; i++) bench_y[i] =
+                           div_long(bench_a[i], bench_b[i]));
+    BENCH_TIME(tc, ti, for (i = 0; i < 4096; i++) bench_y[i] =
+                           bf16_div(bench_a[i], bench_b[i]));
+
+    TEST_LOGGER("  long division: ");
+    bench_print_per_elem(rc, ri, 4096);
+    TEST_LOGGER("\n  reciprocal:    ");
+    bench_print_per_elem(tc, ti, 4096);
+    TEST_LOGGER("\n  saved per bf16_div: ");
+    print_dec_raw(rc > tc ? udiv((unsigned long) (rc - tc), 4096) : 0);
+    TEST_LOGGER(" cycles\n");
+}
+
+/* bench_y[i] = |bench_b[i]|, the operands for the square root runs */
+static void bench_fill_abs(void)
+{
+    for (unsigned long i = 0; i < 4096; i++)
+        bench_y[i].bits = bench_b[i].bits & 0x7FFF;
+}
+
+static void bench_bf16_sqrt(void)
+{
+    uint64_t c, n;
+    unsigned long i;
+
+    TEST_LOGGER("Benchmark: bf16_sqrt / bf16_rsqrt (in place, 4096 elements)\n");
+
+    bench_fill_abs();
+    BENCH_TIME(c, n, for (i = 0; i < 4096; i++) bench_y[i] =
+                         bf16_sqrt(bench_y[i]));
+    TEST_LOGGER("  bf16_sqrt:                 ");
+    bench_print_per_elem(c, n, 4096);
+    TEST_LOGGER("\n");
+
+    bench_fill_abs();
+    BENCH_TIME(c, n, for (i = 0; i < 4096; i++) bench_y[i] =
+                         bf16_rsqrt(bench_y[i]));
+    TEST_LOGGER("  bf16_rsqrt:                ");
+    bench_print_per_elem(c, n, 4096);
+    TEST_LOGGER("\n");
+
+    bench_fill_abs();
+    BENCH_TIME(c, n, for (i = 0; i < 4096; i++) bench_y[i] =
+                         bf16_div(bf16_one, bf16_sqrt(bench_y[i])));
+    TEST_LOGGER("  bf16_div(one, bf16_sqrt):  ");
+    bench_print_per_elem(c, n, 4096);
+    TEST_LOGGER("\n");
+}
+
+static void bench_bf16_dot(void)
+{
+    static const unsigned long sizes[] = {16, 256, 4096};
+    uint64_t cc, ci, dc, di;
+    unsigned long n, i;
+    bf16_t chain, dot;
+
+    TEST_LOGGER("Benchmark: bf16_dot vs bf16_mul + bf16_add chain\n");
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        n = sizes[s];
+        TEST_LOGGER("  n = ");
+        print_dec(n);
+
+        BENCH_TIME(cc, ci, chain = BF16_ZERO();
+                   for (i = 0; i < n; i++) chain =
+                       bf16_add(chain, bf16_mul(bench_a[i], bench_b[i])));
+        BENCH_TIME(dc, di, dot = bf16_dot(bench_a, bench_b, n));
+
+        TEST_LOGGER("    chain: ");
+        bench_print_per_elem(cc, ci, n);
+        TEST_LOGGER(", result ");
+        print_hex(chain.bits);
+        TEST_LOGGER("    dot:   ");
+        bench_print_per_elem(dc, di, n);
+        TEST_LOGGER(", result ");
+        print_hex(dot.bits);
+    }
+
+    TEST_LOGGER("  single op, 4096 calls\n");
+    BENCH_TIME(cc, ci, for (i = 0; i < 4096; i++) bench_y[i] = bf16_add(
+                           bf16_mul(bench_a[i], bench_b[i]), bench_y[i]));
+    BENCH_TIME(dc, di, for (i = 0; i < 4096; i++) bench_y[i] =
+                           bf16_fma(bench_a[i], bench_b[i], bench_y[i]));
+    TEST_LOGGER("    bf16_add(bf16_mul): ");
+    bench_print_per_elem(cc, ci, 4096);
+    TEST_LOGGER("\n    bf16_fma:           ");
+    bench_print_per_elem(dc, di, 4096);
+    TEST_LOGGER("\n");
+}
+
+/* Print "<cycles> cyc/MAC (<instret> inst)" for a run of macs multiply-adds */
+static void bench_print_per_mac(uint64_t cycles,
+                                uint64_t instret,
+                                unsigned long macs)
+{
+    print_dec_raw(udiv((unsigned long) cycles, macs));
+    TEST_LOGGER(" cyc/MAC (");
+    print_dec_raw(udiv((unsigned long) instret, macs));
+    TEST_LOGGER(" inst)");
+}
+
+static void bench_bf16_gemm(void)
+{
+    /* square, then tall-skinny, short-wide and matrix-vector shapes */
+    static const struct {
+        uint16_t m, n, k;
+    } shapes[] = {
+        {16, 16, 16}, {32, 32, 32}, {64, 64, 64},  {256, 4, 64},
+        {4, 256, 64}, {1, 256, 256}, {256, 1, 256},
+    };
+    uint64_t dc, di, gc, gi;
+    unsigned long m, n, k, i, j;
+
+    TEST_LOGGER("Benchmark: bf16_gemm vs bf16_dot per element\n");
+
+    for (size_t s = 0; s < sizeof(shapes) / sizeof(shapes[0]); s++) {
+        m = shapes[s].m;
+        n = shapes[s].n;
+        k = shapes[s].k;
+        unsigned long macs = umul(umul(m, n), k);
+
+        TEST_LOGGER("  ");
+        print_dec_raw(m);
+        TEST_LOGGER("x");
+        print_dec_raw(n);
+        TEST_LOGGER("x");
+        print_dec(k);
+
+        BENCH_TIME(dc, di, for (i = 0; i < m; i++) for (j = 0; j < n; j++)
+                               bench_y[umul(i, n) + j] = bf16_dot_stride(
+                                   bench_a + umul(i, k), 1, bench_b + j, n, k));
+        BENCH_TIME(gc, gi,
+                   bf16_gemm(m, n, k, bench_a, k, bench_b, n, bench_y, n));
+
+        TEST_LOGGER("    dot:  ");
+        bench_print_per_mac(dc, di, macs);
+        TEST_LOGGER("\n    gemm: ");
+        bench_print_per_mac(gc, gi, macs);
+        TEST_LOGGER("\n");
+    }
+}
+
+/* C and assembly on the same 4096 pairs, results cross-checked */
+static void bench_bf16_asm(void)
+{
+    static bf16_t out_c[4096], out_asm[4096];
+    uint64_t cc, ci, ac, ai;
+    unsigned long i;
+    bool same;
+
+    TEST_LOGGER("Benchmark: bf16 C vs assembly (4096 pairs)\n");
+
+    BENCH_TIME(cc, ci, for (i = 0; i < 4096; i++) out_c[i] =
+                           bf16_add(bench_a[i], bench_b[i]));
+    BENCH_TIME(ac, ai, for (i = 0; i < 4096; i++) out_asm[i] =
+                           bf16_add_asm(bench_a[i], bench_b[i]));
+    same = !memcmp(out_c, out_asm, sizeof(out_c));
+    TEST_LOGGER("  add: C ");
+    bench_print_per_elem(cc, ci, 4096);
+    TEST_LOGGER(" | asm ");
+    bench_print_per_elem(ac, ai, 4096);
+    if (same) {
+        TEST_LOGGER(", match\n");
+    } else {
+        TEST_LOGGER(", MISMATCH\n");
+    }
+
+    BENCH_TIME(cc, ci, for (i = 0; i < 4096; i++) out_c[i] =
+                           bf16_sub(bench_a[i], bench_b[i]));
+    BENCH_TIME(ac, ai, for (i = 0; i < 4096; i++) out_asm[i] =
+                           bf16_sub_asm(bench_a[i], bench_b[i]));
+    same = !memcmp(out_c, out_asm, sizeof(out_c));
+    TEST_LOGGER("  sub: C ");
+    bench_print_per_elem(cc, ci, 4096);
+    TEST_LOGGER(" | asm ");
+    bench_print_per_elem(ac, ai, 4096);
+    if (same) {
+        TEST_LOGGER(", match\n");
+    } else {
+        TEST_LOGGER(", MISMATCH\n");
+    }
+
+    BENCH_TIME(cc, ci, for (i = 0; i < 4096; i++) out_c[i] =
+                           bf16_mul(bench_a[i], bench_b[i]));
+    BENCH_TIME(ac, ai, for (i = 0; i < 4096; i++) out_asm[i] =
+                           bf16_mul_asm(bench_a[i], bench_b[i]));
+    same = !memcmp(out_c, out_asm, sizeof(out_c));
+    TEST_LOGGER("  mul: C ");
+    bench_print_per_elem(cc, ci, 4096);
+    TEST_LOGGER(" | asm ");
+    bench_print_per_elem(ac, ai, 4096);
+    if (same) {
+        TEST_LOGGER(", match\n");
+    } else {
+        TEST_LOGGER(", MISMATCH\n");
+    }
+}
+
+/* Print "<elements per 1000 cycles> elem/kcycle" for a run over n elements */
+static void bench_print_rate(uint64_t cycles, unsigned long n)
+{
+    print_dec_raw(cycles ? udiv(umul(n, 1000), (unsigned long) cycles) : 0);
+    TEST_LOGGER(" elem/kcycle");
+}
+
+/* One row of the bf16x2 benchmark: scalar and packed rates with
+ * instructions per element, and whether the two outputs agree
+ */
+static void bench_bf16x2_row(uint64_t sc,
+                             uint64_t si,
+                             uint64_t pc,
+                             uint64_t pi,
+                             bool same)
+{
+    TEST_LOGGER("scalar ");
+    bench_print_rate(sc, 4096);
+    TEST_LOGGER(" (");
+    print_dec_raw(udiv((unsigned long) si, 4096));
+    TEST_LOGGER(" inst/elem) | bf16x2 ");
+    bench_print_rate(pc, 4096);
+    TEST_LOGGER(" (");
+    print_dec_raw(udiv((unsigned long) pi, 4096));
+    TEST_LOGGER(" inst/elem)");
+    if (same) {
+        TEST_LOGGER(", match\n");
+    } else {
+        TEST_LOGGER(", MISMATCH\n");
+    }
+}
+
+static void bench_bf16x2(void)
+{
+    static bf16_t out_s[4096] __attribute__((aligned(4)));
+    static bf16_t out_p[4096] __attribute__((aligned(4)));
+    uint64_t sc, si, pc, pi;
+    unsigned long i;
+
+    TEST_LOGGER("Benchmark: bf16 scalar vs bf16x2 packed (4096 elements)\n");
+
+    BENCH_TIME(sc, si, for (i = 0; i < 4096; i++) out_s[i] =
+                          bf16_add(bench_a[i], bench_b[i]));
+    BENCH_TIME(pc, pi, for (i = 0; i < 4096; i += 2) bf16x2_store(
+                          out_p + i, bf16x2_add(bf16x2_load(bench_a + i),
+                                                bf16x2_load(bench_b + i))));
+    TEST_LOGGER("  add: ");
+    bench_bf16x2_row(sc, si, pc, pi, !memcmp(out_s, out_p, sizeof(out_s)));
+
+    BENCH_TIME(sc, si, for (i = 0; i < 4096; i++) out_s[i] =
+                          bf16_mul(bench_a[i], bench_b[i]));
+    BENCH_TIME(pc, pi, for (i = 0; i < 4096; i += 2) bf16x2_store(
+                          out_p + i, bf16x2_mul(bf16x2_load(bench_a + i),
+                                                bf16x2_load(bench_b + i))));
+    TEST_LOGGER("  mul: ");
+    bench_bf16x2_row(sc, si, pc, pi, !memcmp(out_s, out_p, sizeof(out_s)));
+
+    BENCH_TIME(sc, si, for (i = 0; i < 4096; i++) out_s[i].bits =
+                          bf16_lt(bench_a[i], bench_b[i]) ? 0xFFFF : 0);
+    BENCH_TIME(pc, pi, for (i = 0; i < 4096; i += 2) bf16x2_store(
+                          out_p + i,
+                          (bf16x2_t) {.bits = bf16x2_lt(bf16x2_load(bench_a + i),
+                                                        bf16x2_load(bench_b + i))}));
+    TEST_LOGGER("  lt:  ");
+    bench_bf16x2_row(sc, si, pc, pi, !memcmp(out_s, out_p, sizeof(out_s)));
+
+    BENCH_TIME(sc, si, for (i = 0; i < 4096; i++) out_s[i].bits =
+                          bench_a[i].bits & 0x7FFF);
+    BENCH_TIME(pc, pi, for (i = 0; i < 4096; i += 2) bf16x2_store(
+                          out_p + i, bf16x2_abs(bf16x2_load(bench_a + i))));
+    TEST_LOGGER("  abs: ");
+    bench_bf16x2_row(sc, si, pc, pi, !memcmp(out_s, out_p, sizeof(out_s)));
+}
+
+/* bench_y[i] = bench_b[i] scaled into 2^-5 <= |x| < 8, where an activation
+ * function is neither linear nor saturated
+ */
+static void bench_fill_act(void)
+{
+    for (unsigned long i = 0; i < 4096; i++)
+        bench_y[i].bits = (bench_b[i].bits & 0x807F) |
+                          ((122 + ((bench_b[i].bits >> 7) & 7)) << 7);
+}
+
+static void bench_bf16_math(void)
+{
+    uint64_t c, n;
+    unsigned long i;
+
+    TEST_LOGGER("Benchmark: transcendental functions (in place, 4096 elements)\n");
+
+    bench_fill_act();
+    BENCH_TIME(c, n, for (i = 0; i < 4096; i++) bench_y[i] =
+                         bf16_exp(bench_y[i]));
+    TEST_LOGGER("  bf16_exp:                  ");
+    bench_print_per_elem(c, n, 4096);
+    TEST_LOGGER("\n");
+
+    bench_fill_abs();
+    BENCH_TIME(c, n, for (i = 0; i < 4096; i++) bench_y[i] =
+                         bf16_log(bench_y[i]));
+    TEST_LOGGER("  bf16_log:                  ");
+    bench_print_per_elem(c, n, 4096);
+    TEST_LOGGER("\n");
+
+    bench_fill_act();
+    BENCH_TIME(c, n, for (i = 0; i < 4096; i++) bench_y[i] =
+                         bf16_sigmoid(bench_y[i]));
+    TEST_LOGGER("  bf16_sigmoid:              ");
+    bench_print_per_elem(c, n, 4096);
+    TEST_LOGGER("\n");
+
+    /* the same function composed from the basic ops */
+    bench_fill_act();
+    BENCH_TIME(c, n, for (i = 0; i < 4096; i++) bench_y[i] = bf16_div(
+                         bf16_one, bf16_add(bf16_one, bf16_exp((bf16_t) {
+                                       .bits = bench_y[i].bits ^ 0x8000}))));
+    TEST_LOGGER("  1 / (1 + bf16_exp(-x)):    ");
+    bench_print_per_elem(c, n, 4096);
+    TEST_LOGGER("\n");
+
+    bench_fill_act();
+    BENCH_TIME(c, n, for (i = 0; i < 4096; i++) bench_y[i] =
+                         bf16_tanh(bench_y[i]));
+    TEST_LOGGER("  bf16_tanh:                 ");
+    bench_print_per_elem(c, n, 4096);
+    TEST_LOGGER("\n");
+
+    bench_fill_act();
+    BENCH_TIME(c, n, for (i = 0; i < 4096; i++) bench_y[i] =
+                         bf16_gelu(bench_y[i]));
+    TEST_LOGGER("  bf16_gelu:                 ");
+    bench_print_per_elem(c, n, 4096);
+    TEST_LOGGER("\n");
+}
+
+/* One row of the finite-math benchmark: both variants, whether their
+ * outputs agree (the operands keep every result normal)
+ */
+static void bench_finite_row(uint64_t fc,
+                             uint64_t fi,
+                             uint64_t nc,
+                             uint64_t ni,
+                             bool same)
+{
+    TEST_LOGGER("full ");
+    bench_print_per_elem(fc, fi, 4096);
+    TEST_LOGGER(" | finite ");
+    bench_print_per_elem(nc, ni, 4096);
+    if (same) {
+        TEST_LOGGER(", match\n");
+    } else {
+        TEST_LOGGER(", MISMATCH\n");
+    }
+}
+
+static void bench_bf16_finite(void)
+{
+    static bf16_t out_f[4096];
+    static bf16_t out_n[4096];
+    uint64_t fc, fi, nc, ni;
+    unsigned long i;
+
+    TEST_LOGGER("Benchmark: full vs finite-math ops (4096 elements)\n");
+
+    BENCH_TIME(fc, fi, for (i = 0; i < 4096; i++) out_f[i] =
+                           bf16_add(bench_a[i], bench_b[i]));
+    BENCH_TIME(nc, ni, for (i = 0; i < 4096; i++) out_n[i] =
+                           bf16_add_finite(bench_a[i], bench_b[i]));
+    TEST_LOGGER("  add: ");
+    bench_finite_row(fc, fi, nc, ni, !memcmp(out_f, out_n, sizeof(out_f)));
+
+    BENCH_TIME(fc, fi, for (i = 0; i < 4096; i++) out_f[i] =
+                           bf16_sub(bench_a[i], bench_b[i]));
+    BENCH_TIME(nc, ni, for (i = 0; i < 4096; i++) out_n[i] =
+                           bf16_sub_finite(bench_a[i], bench_b[i]));
+    TEST_LOGGER("  sub: ");
+    bench_finite_row(fc, fi, nc, ni, !memcmp(out_f, out_n, sizeof(out_f)));
+
+    BENCH_TIME(fc, fi, for (i = 0; i < 4096; i++) out_f[i] =
+                           bf16_mul(bench_a[i], bench_b[i]));
+    BENCH_TIME(nc, ni, for (i = 0; i < 4096; i++) out_n[i] =
+                           bf16_mul_finite(bench_a[i], bench_b[i]));
+    TEST_LOGGER("  mul: ");
+    bench_finite_row(fc, fi, nc, ni, !memcmp(out_f, out_n, sizeof(out_f)));
+
+    BENCH_TIME(fc, fi, for (i = 0; i < 4096; i++) out_f[i] =
+                           bf16_div(bench_a[i], bench_b[i]));
+    BENCH_TIME(nc, ni, for (i = 0; i < 4096; i++) out_n[i] =
+                           bf16_div_finite(bench_a[i], bench_b[i]));
+    TEST_LOGGER("  div: ");
+    bench_finite_row(fc, fi, nc, ni, !memcmp(out_f, out_n, sizeof(out_f)));
+}
+
+static void bench_bf16_sort(void)
+{
+    static const unsigned long sizes[] = {256, 1024, 4096};
+    static bf16_t out_s[4096];
+    uint64_t rc, ri, sc, si;
+
+    TEST_LOGGER("Benchmark: bf16_sort_n vs shell sort (random values)\n");
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        unsigned long n = sizes[s];
+
+        memcpy(bench_y, bench_a, n * sizeof(bf16_t));
+        BENCH_TIME(rc, ri, bf16_sort_n(bench_y, bench_y + 4096, n));
+        memcpy(out_s, bench_a, n * sizeof(bf16_t));
+        BENCH_TIME(sc, si, shell_sort_bf16(out_s, n));
+
+        TEST_LOGGER("  n = ");
+        print_dec(n);
+        TEST_LOGGER("    radix ");
+        bench_print_per_elem(rc, ri, n);
+        TEST_LOGGER(" | shell ");
+        bench_print_per_elem(sc, si, n);
+        if (!memcmp(bench_y, out_s, n * sizeof(bf16_t))) {
+            TEST_LOGGER(", match\n");
+        } else {
+            TEST_LOGGER(", MISMATCH\n");
+        }
+    }
+}
+
+static void bench_f32_convert(void)
+{
+    static uint32_t f[4096];
+    uint64_t sc, si, ac, ai;
+    unsigned long i;
+
+    TEST_LOGGER("Benchmark: float32 <-> bf16 conversion (4096 elements)\n");
+
+    /* float32 inputs with random low halves, so that every rounding case
+     * comes up
+     */
+    for (i = 0; i < 4096; i++)
+        f[i] = bf16_to_f32(bench_a[i]) | (bench_rand() & 0xFFFF);
+
+    TEST_LOGGER("  f32_to_bf16: ");
+    BENCH_TIME(sc, si, for (i = 0; i < 4096; i++) bench_y[i] =
+                           f32_to_bf16(f[i]));
+    BENCH_TIME(ac, ai, f32_to_bf16_n(bench_y, f, 4096));
+    bench_print_row(sc, si, ac, ai, 4096);
+
+    TEST_LOGGER("  bf16_to_f32: ");
+    BENCH_TIME(sc, si, for (i = 0; i < 4096; i++) f[i] =
+                           bf16_to_f32(bench_y[i]));
+    BENCH_TIME(ac, ai, bf16_to_f32_n(f, bench_y, 4096));
+    bench_print_row(sc, si, ac, ai, 4096);
+}
+
+/* The whole batch end to end; the weights are read from .data each pass */
+static void bench_bf16_mlp(void)
+{
+    static bf16_t out[BF16_MLP_BATCH * BF16_MLP_OUT];
+    uint64_t c, in;
+    unsigned long b, macs = umul(BF16_MLP_MACS, BF16_MLP_BATCH);
+
+    TEST_LOGGER("Benchmark: bf16 MLP inference, 64-32-32-10, batch of 8\n");
+
+    BENCH_TIME(c, in, for (b = 0; b < BF16_MLP_BATCH; b++)
+                          bf16_mlp_forward(out + umul(b, BF16_MLP_OUT),
+                                           bf16_mlp_input +
+                                               umul(b, BF16_MLP_IN)));
+
+    TEST_LOGGER("  total:     ");
+    print_dec_raw((unsigned long) c);
+    TEST_LOGGER(" cycles (");
+    print_dec_raw((unsigned long) in);
+    TEST_LOGGER(" inst), ");
+    print_dec_raw(macs);
+    TEST_LOGGER(" MACs\n  per MAC:   ");
+    bench_print_per_mac(c, in, macs);
+    TEST_LOGGER("\n  checksum:  0x");
+    print_hex(mlp_checksum(out, BF16_MLP_BATCH * BF16_MLP_OUT));
+}
+
+/* "<n> ulp off, result <hex>" against the exact sum */
+static void bench_print_sum(bf16_t r, bf16_t exact)
+{
+    uint32_t kr = bf16_key(r), ke = bf16_key(exact);
+
+    print_dec_raw(kr > ke ? kr - ke : ke - kr);
+    TEST_LOGGER(" ulp off, result 0x");
+    print_hex(r.bits);
+}
+
+static void bench_bf16_reduce(void)
+{
+    static const unsigned long sizes[] = {256, 4096, 65536};
+    uint64_t cc, ci, sc, si;
+    unsigned long n, i;
+    bf16_t chain, sum;
+
+    TEST_LOGGER("Benchmark: bf16 reductions, bf16_add chain vs bf16_sum_n\n");
+
+    /* values in [1, 2), each mant * 2^-7: the exact sum is an integer
+     * times 2^-7 and rounds like any other fixed-point value
+     */
+    for (i = 0; i < BENCH_MAX_N; i++)
+        bench_y[i].bits = 0x3F80 | (bench_rand() & 0x7F);
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        uint32_t total = 0;
+
+        n = sizes[s];
+        for (i = 0; i < n; i++)
+            total += (bench_y[i].bits & 0x7F) | 0x80;
+        unsigned lz = clz(total);
+        bf16_t exact = bf16_round_pack(0, 151 - lz, (total << lz) >> 1);
+
+        BENCH_TIME(cc, ci, chain = BF16_ZERO();
+                   for (i = 0; i < n; i++) chain = bf16_add(chain, bench_y[i]));
+        BENCH_TIME(sc, si, sum = bf16_sum_n(bench_y, n));
+
+        TEST_LOGGER("  n = ");
+        print_dec_raw(n);
+        TEST_LOGGER(", exact sum 0x");
+        print_hex(exact.bits);
+        TEST_LOGGER("    chain:      ");
+        bench_print_per_elem(cc, ci, n);
+        TEST_LOGGER(", ");
+        bench_print_sum(chain, exact);
+        TEST_LOGGER("    bf16_sum_n: ");
+        bench_print_per_elem(sc, si, n);
+        TEST_LOGGER(", ");
+        bench_print_sum(sum, exact);
+    }
+
+    TEST_LOGGER("  65536 random values\n");
+    BENCH_TIME(sc, si, sum = bf16_norm2_n(bench_a, BENCH_MAX_N));
+    TEST_LOGGER("    bf16_norm2_n:  ");
+    bench_print_per_elem(sc, si, BENCH_MAX_N);
+    BENCH_TIME(sc, si, sum = bf16_max_n(bench_a, BENCH_MAX_N));
+    TEST_LOGGER("\n    bf16_max_n:    ");
+    bench_print_per_elem(sc, si, BENCH_MAX_N);
+    BENCH_TIME(sc, si, n = bf16_argmax_n(bench_a, BENCH_MAX_N));
+    TEST_LOGGER("\n    bf16_argmax_n: ");
+    bench_print_per_elem(sc, si, BENCH_MAX_N);
+    TEST_LOGGER("\n");
+}
+
+/* Print "<cycles> cyc/byte (<instret> inst)" for a run over n bytes */
+static void bench_print_per_byte(uint64_t cycles,
+                                 uint64_t instret,
+                                 unsigned long n)
+{
+    print_dec_raw(udiv((unsigned long) cycles, n));
+    TEST_LOGGER(" cyc/byte (");
+    print_dec_raw(udiv((unsigned long) instret, n));
+    TEST_LOGGER(" inst)");
+}
+
+/* The same 4096-byte stream in pieces of 1, 7, 63 and 4096 bytes */
+static void bench_chacha20_stream(void)
+{
+    static const unsigned long chunks[] = {1, 7, 63, 4096};
+    static uint8_t key[32] __attribute__((aligned(4)));
+    static uint8_t nonce[12] __attribute__((aligned(4)));
+    static uint8_t ref[4096];
+    const uint8_t *in = (const uint8_t *) bench_a;
+    uint8_t *out = (uint8_t *) bench_y;
+    chacha20_ctx_t ctx;
+    uint64_t c, ins;
+    unsigned long i;
+
+    TEST_LOGGER("Benchmark: ChaCha20 streaming, 4096 bytes\n");
+
+    for (i = 0; i < 32; i++)
+        key[i] = bench_rand();
+    for (i = 0; i < 12; i++)
+        nonce[i] = bench_rand();
+
+    BENCH_TIME(c, ins, chacha20(ref, in, 4096, key, nonce, 0));
+    TEST_LOGGER("  chacha20, one call:  ");
+    bench_print_per_byte(c, ins, 4096);
+    TEST_LOGGER("\n");
+
+    for (size_t s = 0; s < sizeof(chunks) / sizeof(chunks[0]); s++) {
+        unsigned long chunk = chunks[s];
+
+        BENCH_TIME(c, ins, chacha20_init(&ctx, key, nonce, 0);
+                   for (i = 0; i + chunk < 4096; i += chunk)
+                       chacha20_update(&ctx, out + i, in + i, chunk);
+                   chacha20_update(&ctx, out + i, in + i, 4096 - i);
+                   chacha20_final(&ctx));
+
+        TEST_LOGGER("  chunks of ");
+        print_dec_raw(chunk);
+        TEST_LOGGER(": ");
+        bench_print_per_byte(c, ins, 4096);
+        if (!memcmp(out, ref, 4096)) {
+            TEST_LOGGER(", match\n");
+        } else {
+            TEST_LOGGER(", MISMATCH\n");
+        }
+    }
+}
+
+/* 4096 bytes with out and in at the given byte offsets */
+static void bench_chacha20_align(void)
+{
+    static const uint8_t offs[][2] = {{0, 0}, {1, 1}, {0, 3}, {2, 1}};
+    static uint8_t key[32] __attribute__((aligned(4)));
+    static uint8_t nonce[12] __attribute__((aligned(4)));
+    static uint8_t ref[4096];
+    uint64_t c, ins;
+
+    TEST_LOGGER("Benchmark: ChaCha20 buffer alignment, 4096 bytes\n");
+
+    for (unsigned long i = 0; i < 32; i++)
+        key[i] = bench_rand();
+    for (unsigned long i = 0; i < 12; i++)
+        nonce[i] = bench_rand();
+    chacha20(ref, (const uint8_t *) bench_a, 4096, key, nonce, 0);
+
+    for (size_t s = 0; s < sizeof(offs) / sizeof(offs[0]); s++) {
+        uint8_t *out = (uint8_t *) bench_y + offs[s][0];
+        uint8_t *in = (uint8_t *) (bench_y + 4096) + offs[s][1];
+
+        memcpy(in, bench_a, 4096);
+        BENCH_TIME(c, ins, chacha20(out, in, 4096, key, nonce, 0));
+
+        TEST_LOGGER("  out + ");
+        print_dec_raw(offs[s][0]);
+        TEST_LOGGER(", in + ");
+        print_dec_raw(offs[s][1]);
+        TEST_LOGGER(": ");
+        bench_print_per_byte(c, ins, 4096);
+        if (!memcmp(out, ref, 4096)) {
+            TEST_LOGGER(", match\n");
+        } else {
+            TEST_LOGGER(", MISMATCH\n");
+        }
+    }
+}
+
+/* seal and open of one message of each size, and Poly1305 alone */
+static void bench_chacha20_poly1305(void)
+{
+    static const unsigned long sizes[] = {64, 256, 1024, 4096};
+    static uint8_t key[32], nonce[12], aad[12], tag[16];
+    static poly1305_ctx_t poly;
+    const uint8_t *in = (const uint8_t *) bench_a;
+    uint8_t *ct = (uint8_t *) bench_y;
+    uint8_t *back = (uint8_t *) (bench_y + 4096);
+    uint64_t c, ins;
+    bool ok;
+
+    TEST_LOGGER("Benchmark: ChaCha20-Poly1305, 12 bytes of AAD\n");
+
+    for (unsigned long i = 0; i < 32; i++)
+        key[i] = bench_rand();
+    for (unsigned long i = 0; i < 12; i++) {
+        nonce[i] = bench_rand();
+        aad[i] = bench_rand();
+    }
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        unsigned long n = sizes[s];
+
+        TEST_LOGGER("  ");
+        print_dec_raw(n);
+        TEST_LOGGER(" bytes, seal: ");
+        BENCH_TIME(c, ins, chacha20_poly1305_seal(ct, tag, in, n, aad, 12,
+                                                  key, nonce));
+        bench_print_per_byte(c, ins, n);
+        TEST_LOGGER(", open: ");
+        BENCH_TIME(c, ins, ok = chacha20_poly1305_open(back, ct, n, tag, aad,
+                                                       12, key, nonce));
+        bench_print_per_byte(c, ins, n);
+        if (ok && !memcmp(back, in, n)) {
+            TEST_LOGGER(", match\n");
+        } else {
+            TEST_LOGGER(", MISMATCH\n");
+        }
+    }
+
+    BENCH_TIME(c, ins, poly1305_init(&poly, key);
+               poly1305_update(&poly, in, 4096); poly1305_final(&poly, tag));
+    TEST_LOGGER("  Poly1305 alone, 4096 bytes: ");
+    bench_print_per_byte(c, ins, 4096);
+    TEST_LOGGER("\n");
+}
+
+/* The subkey derivation alone, then xchacha20 against chacha20 per
+ * message: the difference is the extended nonce's cost
+ */
+static void bench_xchacha20(void)
+{
+    static const unsigned long sizes[] = {64, 256, 1024, 4096};
+    static uint8_t key[32], nonce[24], subkey[32];
+    const uint8_t *in = (const uint8_t *) bench_a;
+    uint8_t *out = (uint8_t *) bench_y;
+    uint64_t c, ins, xc, xins;
+
+    TEST_LOGGER("Benchmark: XChaCha20 subkey derivation\n");
+
+    for (unsigned long i = 0; i < 32; i++)
+        key[i] = bench_rand();
+    for (unsigned long i = 0; i < 24; i++)
+        nonce[i] = bench_rand();
+
+    BENCH_TIME(c, ins, hchacha20(subkey, key, nonce));
+    TEST_LOGGER("  hchacha20: ");
+    print_dec_raw((unsigned long) c);
+    TEST_LOGGER(" cycles (");
+    print_dec_raw((unsigned long) ins);
+    TEST_LOGGER(" inst)\n");
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        unsigned long n = sizes[s];
+
+        BENCH_TIME(c, ins, chacha20(out, in, n, key, nonce, 0));
+        BENCH_TIME(xc, xins, xchacha20(out, in, n, key, nonce, 0));
+
+        TEST_LOGGER("  ");
+        print_dec_raw(n);
+        TEST_LOGGER(" bytes: chacha20 ");
+        bench_print_per_byte(c, ins, n);
+        TEST_LOGGER(", xchacha20 ");
+        bench_print_per_byte(xc, xins, n);
+        TEST_LOGGER(", +");
+        print_dec_raw((unsigned long) (xc - c));
+        TEST_LOGGER(" cycles\n");
+    }
+}
+
+/* Print "<bytes per 1000 cycles> bytes/kcycle" for a run over n bytes */
+static void bench_print_byte_rate(uint64_t cycles, unsigned long n)
+{
+    print_dec_raw(cycles ? udiv(umul(n, 1000), (unsigned long) cycles) : 0);
+    TEST_LOGGER(" bytes/kcycle");
+}
+
+/* 4096 random bytes: chacha20 over a zero buffer, the keystream path
+ * alone, csprng_fill in one call and in 16-byte requests, and 1024
+ * csprng_u32 calls
+ */
+static void bench_csprng(void)
+{
+    static uint8_t key[32], nonce[12];
+    chacha20_ctx_t ctx;
+    uint8_t *out = (uint8_t *) bench_y;
+    uint8_t *zero = (uint8_t *) (bench_y + 4096);
+    uint64_t c, ins;
+    unsigned long i;
+    uint32_t sink = 0;
+
+    TEST_LOGGER("Benchmark: ChaCha20 CSPRNG, 4096 bytes\n");
+
+    for (i = 0; i < 32; i++)
+        key[i] = bench_rand();
+    for (i = 0; i < 12; i++)
+        nonce[i] = bench_rand();
+    memset(zero, 0, 4096);
+    csprng_seed(key, 32);
+
+    BENCH_TIME(c, ins, chacha20(out, zero, 4096, key, nonce, 0));
+    TEST_LOGGER("  chacha20 over zeros:    ");
+    bench_print_byte_rate(c, 4096);
+    TEST_LOGGER(", ");
+    bench_print_per_byte(c, ins, 4096);
+    TEST_LOGGER("\n");
+
+    chacha20_init(&ctx, key, nonce, 0);
+    BENCH_TIME(c, ins, chacha20_keystream((uint32_t *) out, 64, ctx.state));
+    TEST_LOGGER("  chacha20_keystream:     ");
+    bench_print_byte_rate(c, 4096);
+    TEST_LOGGER(", ");
+    bench_print_per_byte(c, ins, 4096);
+    TEST_LOGGER("\n");
+
+    BENCH_TIME(c, ins, csprng_fill(out, 4096));
+    TEST_LOGGER("  csprng_fill, one call:  ");
+    bench_print_byte_rate(c, 4096);
+    TEST_LOGGER(", ");
+    bench_print_per_byte(c, ins, 4096);
+    TEST_LOGGER("\n");
+
+    BENCH_TIME(c, ins, for (i = 0; i < 4096; i += 16) csprng_fill(out + i, 16));
+    TEST_LOGGER("  csprng_fill, 16 bytes:  ");
+    bench_print_byte_rate(c, 4096);
+    TEST_LOGGER(", ");
+    bench_print_per_byte(c, ins, 4096);
+    TEST_LOGGER("\n");
+
+    BENCH_TIME(c, ins, for (i = 0; i < 1024; i++) sink ^= csprng_u32());
+    TEST_LOGGER("  csprng_u32:             ");
+    bench_print_byte_rate(c, 4096);
+    TEST_LOGGER(", ");
+    bench_print_per_byte(c, ins, 4096);
+    TEST_LOGGER("\n");
+    (void) sink;
+}
+
+/* 4096 bytes at each round count */
+static void bench_chacha_rounds(void)
+{
+    static uint8_t key[32], nonce[12];
+    const uint8_t *in = (const uint8_t *) bench_a;
+    uint8_t *out = (uint8_t *) bench_y;
+    uint64_t c, ins;
+
+    TEST_LOGGER("Benchmark: ChaCha round counts, 4096 bytes\n");
+
+    for (unsigned long i = 0; i < 32; i++)
+        key[i] = bench_rand();
+    for (unsigned long i = 0; i < 12; i++)
+        nonce[i] = bench_rand();
+
+    BENCH_TIME(c, ins, chacha8(out, in, 4096, key, nonce, 0));
+    TEST_LOGGER("  chacha8:  ");
+    bench_print_per_byte(c, ins, 4096);
+    TEST_LOGGER("\n");
+
+    BENCH_TIME(c, ins, chacha12(out, in, 4096, key, nonce, 0));
+    TEST_LOGGER("  chacha12: ");
+    bench_print_per_byte(c, ins, 4096);
+    TEST_LOGGER("\n");
+
+    BENCH_TIME(c, ins, chacha20(out, in, 4096, key, nonce, 0));
+    TEST_LOGGER("  chacha20: ");
+    bench_print_per_byte(c, ins, 4096);
+    TEST_LOGGER("\n");
+}
+
+/* print_dec_raw right-aligned in width columns */
+static void bench_print_padded(unsigned long val, int width)
+{
+    unsigned long v = val;
+    int digits = 1;
+
+    while (v >= 10) {
+        v = udiv(v, 10);
+        digits++;
+    }
+    for (; digits < width; digits++)
+        TEST_LOGGER(" ");
+    print_dec_raw(val);
+}
+
+/* num / den with two decimals, right-aligned in width columns */
+static void bench_print_centi(unsigned long num, unsigned long den, int width)
+{
+    unsigned long q = udiv(umul(num, 100), den);
+
+    bench_print_padded(udiv(q, 100), width - 3);
+    TEST_LOGGER(".");
+    q = umod(q, 100);
+    if (q < 10)
+        TEST_LOGGER("0");
+    print_dec_raw(q);
+}
+
+/* chacha20 from 1 byte to 64 KiB: powers of two, and sizes around block
+ * and word boundaries that end in the partial-block tail.  Only the
+ * cipher call is timed; each size is the best of BENCH_SWEEP_RUNS.
+ */
+#define BENCH_SWEEP_RUNS 3
+
+static void bench_chacha20_sweep(void)
+{
+    static const unsigned long sizes[] = {
+        1,    2,    3,    4,     7,     8,     16,    32,    63,
+        64,   65,   127,  128,   129,   256,   512,   1023,  1024,
+        2048, 4096, 4097, 8192, 16384, 32768, 65535, 65536,
+    };
+    static uint8_t key[32], nonce[12];
+    const uint8_t *in = (const uint8_t *) bench_a;
+    uint8_t *out = (uint8_t *) bench_y;
+
+    TEST_LOGGER("Benchmark: ChaCha20 size sweep, best of ");
+    print_dec_raw(BENCH_SWEEP_RUNS);
+    TEST_LOGGER(" runs\n");
+    TEST_LOGGER("    bytes    cycles  cyc/byte inst/byte\n");
+
+    for (unsigned long i = 0; i < 32; i++)
+        key[i] = bench_rand();
+    for (unsigned long i = 0; i < 12; i++)
+        nonce[i] = bench_rand();
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        unsigned long n = sizes[s];
+        uint64_t c, ins, best_c = ~(uint64_t) 0, best_i = 0;
+
+        for (int r = 0; r < BENCH_SWEEP_RUNS; r++) {
+            BENCH_TIME(c, ins, chacha20(out, in, n, key, nonce, 0));
+            if (c < best_c) {
+                best_c = c;
+                best_i = ins;
+            }
+        }
+
+        TEST_LOGGER("  ");
+        bench_print_padded(n, 7);
+        bench_print_padded((unsigned long) best_c, 10);
+        bench_print_centi((unsigned long) best_c, n, 10);
+        bench_print_centi((unsigned long) best_i, n, 10);
+        TEST_LOGGER("\n");
+    }
+}
+
+/* A 1500-byte packet as a 20-byte header, three 400-byte payload
+ * fragments and a 280-byte trailer: gathered into a staging buffer then
+ * encrypted, against chacha20_iov straight from the fragments
+ */
+static void bench_chacha20_iov(void)
+{
+    static const unsigned long lens[5] = {20, 400, 400, 400, 280};
+    static uint8_t key[32], nonce[12];
+    static uint8_t staging[1500] __attribute__((aligned(4)));
+    static uint8_t ref[1500];
+    struct iovec_lite in[5], out[5];
+    uint8_t *src = (uint8_t *) bench_a; /* fragments 4 bytes apart */
+    uint8_t *dst = (uint8_t *) bench_y;
+    unsigned long off = 0, done;
+    uint64_t c, ins;
+    bool ok = true;
+
+    TEST_LOGGER("Benchmark: ChaCha20 over a fragmented 1500-byte packet\n");
+
+    for (unsigned long i = 0; i < 32; i++)
+        key[i] = bench_rand();
+    for (unsigned long i = 0; i < 12; i++)
+        nonce[i] = bench_rand();
+
+    for (size_t f = 0; f < 5; f++) {
+        in[f].base = src + off + 4 * f;
+        in[f].len = lens[f];
+        out[f].base = dst + off;
+        out[f].len = lens[f];
+        off += lens[f];
+    }
+
+    BENCH_TIME(c, ins, done = 0;
+               for (size_t f = 0; f < 5; done += lens[f++])
+                   memcpy(staging + done, in[f].base, lens[f]);
+               chacha20(ref, staging, 1500, key, nonce, 1));
+    TEST_LOGGER("  copy, then chacha20: ");
+    bench_print_per_byte(c, ins, 1500);
+    TEST_LOGGER("\n");
+
+    BENCH_TIME(c, ins, chacha20_iov(in, out, 5, key, nonce, 1));
+    TEST_LOGGER("  chacha20_iov:        ");
+    bench_print_per_byte(c, ins, 1500);
+    if (memcmp(dst, ref, 1500))
+        ok = false;
+    if (ok) {
+        TEST_LOGGER(", match\n");
+    } else {
+        TEST_LOGGER(", MISMATCH\n");
+    }
+}
+
+int main(void)
+{
+    uint64_t start_cycles, end_cycles, cycles_elapsed;
+    uint64_t start_instret, end_instret, instret_elapsed;
+
+#if BF16_AB
+    /* make BF16_AB=1: only the C vs assembly comparison */
+    TEST_LOGGER("\n=== BFloat16 C vs Assembly ===\n\n");
+    test_bf16_asm();
+    bench_init();
+    bench_bf16_asm();
+    TEST_LOGGER("\n=== All Tests Completed ===\n");
+    return 0;
+#endif
+
+    TEST_LOGGER("\n=== ChaCha20 Tests ===\n\n");
+
+    /* Test 0: ChaCha20 */
+    TEST_LOGGER("Test 0: ChaCha20 (RISC-V Assembly)\n");
+    start_cycles = get_cycles();
+    start_instret = get_instret();
+
+    test_chacha20();
+
+    end_cycles = get_cycles();
+    end_instret = get_instret();
+    cycles_elapsed = end_cycles - start_cycles;
+    instret_elapsed = end_instret - start_instret;
+
+    TEST_LOGGER("  Cycles: ");
+    print_dec((unsigned long) cycles_elapsed);
+    TEST_LOGGER("  Instructions: ");
+    print_dec((unsigned long) instret_elapsed);
+    TEST_LOGGER("\n");
+
+    TEST_LOGGER("\n=== BFloat16 Tests ===\n\n");
+
+    /* Test 1: Addition */
+    TEST_LOGGER("Test 1: bf16_add\n");
+    start_cycles = get_cycles();
+    start_instret = get_instret();
+
+    test_bf16_add();
+
+    end_cycles = get_cycles();
+    end_instret = get_instret();
+    cycles_elapsed = end_cycles - start_cycles;
+    instret_elapsed = end_instret - start_instret;
+
+    TEST_LOGGER("  Cycles: ");
+    print_dec((unsigned long) cycles_elapsed);
+    TEST_LOGGER("  Instructions: ");
+    print_dec((unsigned long) instret_elapsed);
+    TEST_LOGGER("\n");
+
+    /* Test 2: Subtraction */
+    TEST_LOGGER("Test 2: bf16_sub\n");
+    start_cycles = get_cycles();
+    start_instret = get_instret();
+
+    test_bf16_sub();
+
+    end_cycles = get_cycles();
+    end_instret = get_instret();
+    cycles_elapsed = end_cycles - start_cycles;
+    instret_elapsed = end_instret - start_instret;
+
+    TEST_LOGGER("  Cycles: ");
+    print_dec((unsigned long) cycles_elapsed);
+    TEST_LOGGER("  Instructions: ");
+    print_dec((unsigned long) instret_elapsed);
+    TEST_LOGGER("\n");
+
+    /* Test 3: Multiplication */
+    TEST_LOGGER("Test 3: bf16_mul\n");
+    start_cycles = get_cycles();
+    start_instret = get_instret();
 
     test_bf16_mul();
 
@@ -681,12 +3047,125 @@ int main(void)
     print_dec((unsigned long) instret_elapsed);
     TEST_LOGGER("\n");
 
-    /* Test 4: Division */
-    TEST_LOGGER("Test 4: bf16_div\n");
+    /* Test 4: Division */
+    TEST_LOGGER("Test 4: bf16_div\n");
+    start_cycles = get_cycles();
+    start_instret = get_instret();
+
+    test_bf16_div();
+
+    end_cycles = get_cycles();
+    end_instret = get_instret();
+    cycles_elapsed = end_cycles - start_cycles;
+    instret_elapsed = end_instret - start_instret;
+
+    TEST_LOGGER("  Cycles: ");
+    print_dec((unsigned long) cycles_elapsed);
+    TEST_LOGGER("  Instructions: ");
+    print_dec((unsigned long) instret_elapsed);
+    TEST_LOGGER("\n");
+
+    /* Test 5: Special cases */
+    TEST_LOGGER("Test 5: bf16_special_cases\n");
+    start_cycles = get_cycles();
+    start_instret = get_instret();
+
+    test_bf16_special_cases();
+
+    end_cycles = get_cycles();
+    end_instret = get_instret();
+    cycles_elapsed = end_cycles - start_cycles;
+    instret_elapsed = end_instret - start_instret;
+
+    /* 原本 bf16 結束後的輸出 */
+    TEST_LOGGER("  Cycles: ");
+    print_dec((unsigned long) cycles_elapsed);
+    TEST_LOGGER("  Instructions: ");
+    print_dec((unsigned long) instret_elapsed);
+    TEST_LOGGER("\n");
+
+    /* Test 6: Array kernels */
+    TEST_LOGGER("Test 6: bf16 array kernels\n");
+    start_cycles = get_cycles();
+    start_instret = get_instret();
+
+    test_bf16_array();
+
+    end_cycles = get_cycles();
+    end_instret = get_instret();
+    cycles_elapsed = end_cycles - start_cycles;
+    instret_elapsed = end_instret - start_instret;
+
+    TEST_LOGGER("  Cycles: ");
+    print_dec((unsigned long) cycles_elapsed);
+    TEST_LOGGER("  Instructions: ");
+    print_dec((unsigned long) instret_elapsed);
+
+    TEST_LOGGER("\n");
+
+    /* Test 7: Mantissa product table */
+    TEST_LOGGER("Test 7: bf16 mantissa product table\n");
+    start_cycles = get_cycles();
+    start_instret = get_instret();
+
+    test_bf16_mul_table();
+
+    end_cycles = get_cycles();
+    end_instret = get_instret();
+    cycles_elapsed = end_cycles - start_cycles;
+    instret_elapsed = end_instret - start_instret;
+
+    TEST_LOGGER("  Cycles: ");
+    print_dec((unsigned long) cycles_elapsed);
+    TEST_LOGGER("  Instructions: ");
+    print_dec((unsigned long) instret_elapsed);
+
+    TEST_LOGGER("\n");
+
+    /* Test 8: Reciprocal division */
+    TEST_LOGGER("Test 8: bf16_div reciprocal engine\n");
+    start_cycles = get_cycles();
+    start_instret = get_instret();
+
+    test_bf16_div_recip();
+
+    end_cycles = get_cycles();
+    end_instret = get_instret();
+    cycles_elapsed = end_cycles - start_cycles;
+    instret_elapsed = end_instret - start_instret;
+
+    TEST_LOGGER("  Cycles: ");
+    print_dec((unsigned long) cycles_elapsed);
+    TEST_LOGGER("  Instructions: ");
+    print_dec((unsigned long) instret_elapsed);
+
+    TEST_LOGGER("\n");
+
+    /* Test 9: Square root */
+    TEST_LOGGER("Test 9: bf16_sqrt / bf16_rsqrt\n");
+    start_cycles = get_cycles();
+    start_instret = get_instret();
+
+    test_bf16_sqrt();
+
+    end_cycles = get_cycles();
+    end_instret = get_instret();
+    cycles_elapsed = end_cycles - start_cycles;
+    instret_elapsed = end_instret - start_instret;
+
+    TEST_LOGGER("  Cycles: ");
+    print_dec((unsigned long) cycles_elapsed);
+    TEST_LOGGER("  Instructions: ");
+    print_dec((unsigned long) instret_elapsed);
+
+    TEST_LOGGER("\n");
+
+    /* Test 10: Fused multiply-add and dot product */
+    TEST_LOGGER("Test 10: bf16_fma / bf16_dot\n");
     start_cycles = get_cycles();
     start_instret = get_instret();
 
-    test_bf16_div();
+    test_bf16_fma();
 
     end_cycles = get_cycles();
     end_instret = get_instret();
@@ -697,21 +3176,306 @@ int main(void)
     print_dec((unsigned long) cycles_elapsed);
     TEST_LOGGER("  Instructions: ");
     print_dec((unsigned long) instret_elapsed);
+
     TEST_LOGGER("\n");
 
-    /* Test 5: Special cases */
-    TEST_LOGGER("Test 5: bf16_special_cases\n");
+    /* Test 11: Matrix multiply */
+    TEST_LOGGER("Test 11: bf16_gemm\n");
     start_cycles = get_cycles();
     start_instret = get_instret();
 
-    test_bf16_special_cases();
+    test_bf16_gemm();
+
+    end_cycles = get_cycles();
+    end_instret = get_instret();
+    cycles_elapsed = end_cycles - start_cycles;
+    instret_elapsed = end_instret - start_instret;
+
+    TEST_LOGGER("  Cycles: ");
+    print_dec((unsigned long) cycles_elapsed);
+    TEST_LOGGER("  Instructions: ");
+    print_dec((unsigned long) instret_elapsed);
+
+    TEST_LOGGER("\n");
+
+    /* Test 12: Assembly core ops */
+    TEST_LOGGER("Test 12: bf16 assembly add/sub/mul\n");
+    start_cycles = get_cycles();
+    start_instret = get_instret();
+
+    test_bf16_asm();
+
+    end_cycles = get_cycles();
+    end_instret = get_instret();
+    cycles_elapsed = end_cycles - start_cycles;
+    instret_elapsed = end_instret - start_instret;
+
+    TEST_LOGGER("  Cycles: ");
+    print_dec((unsigned long) cycles_elapsed);
+    TEST_LOGGER("  Instructions: ");
+    print_dec((unsigned long) instret_elapsed);
+
+    TEST_LOGGER("\n");
+
+    /* Test 13: Packed pairs */
+    TEST_LOGGER("Test 13: bf16x2 packed ops\n");
+    start_cycles = get_cycles();
+    start_instret = get_instret();
+
+    test_bf16x2();
+
+    end_cycles = get_cycles();
+    end_instret = get_instret();
+    cycles_elapsed = end_cycles - start_cycles;
+    instret_elapsed = end_instret - start_instret;
+
+    TEST_LOGGER("  Cycles: ");
+    print_dec((unsigned long) cycles_elapsed);
+    TEST_LOGGER("  Instructions: ");
+    print_dec((unsigned long) instret_elapsed);
+
+    TEST_LOGGER("\n");
+
+    /* Test 14: Transcendental functions */
+    TEST_LOGGER("Test 14: bf16_exp / log / sigmoid / tanh / gelu\n");
+    start_cycles = get_cycles();
+    start_instret = get_instret();
+
+    test_bf16_math();
+
+    end_cycles = get_cycles();
+    end_instret = get_instret();
+    cycles_elapsed = end_cycles - start_cycles;
+    instret_elapsed = end_instret - start_instret;
+
+    TEST_LOGGER("  Cycles: ");
+    print_dec((unsigned long) cycles_elapsed);
+    TEST_LOGGER("  Instructions: ");
+    print_dec((unsigned long) instret_elapsed);
+
+    TEST_LOGGER("\n");
+
+    /* Test 15: Finite-math variants */
+    TEST_LOGGER("Test 15: bf16 finite-math add/sub/mul/div\n");
+    start_cycles = get_cycles();
+    start_instret = get_instret();
+
+    test_bf16_finite();
+
+    end_cycles = get_cycles();
+    end_instret = get_instret();
+    cycles_elapsed = end_cycles - start_cycles;
+    instret_elapsed = end_instret - start_instret;
+
+    TEST_LOGGER("  Cycles: ");
+    print_dec((unsigned long) cycles_elapsed);
+    TEST_LOGGER("  Instructions: ");
+    print_dec((unsigned long) instret_elapsed);
+
+    TEST_LOGGER("\n");
+
+    /* Test 16: Ordering and sort */
+    TEST_LOGGER("Test 16: bf16 keys, min / max and radix sort\n");
+    start_cycles = get_cycles();
+    start_instret = get_instret();
+
+    test_bf16_sort();
+
+    end_cycles = get_cycles();
+    end_instret = get_instret();
+    cycles_elapsed = end_cycles - start_cycles;
+    instret_elapsed = end_instret - start_instret;
+
+    TEST_LOGGER("  Cycles: ");
+    print_dec((unsigned long) cycles_elapsed);
+    TEST_LOGGER("  Instructions: ");
+    print_dec((unsigned long) instret_elapsed);
+
+    TEST_LOGGER("\n");
+
+    /* Test 17: float32 conversion */
+    TEST_LOGGER("Test 17: float32 <-> bf16 conversion\n");
+    start_cycles = get_cycles();
+    start_instret = get_instret();
+
+    test_f32_convert();
+
+    end_cycles = get_cycles();
+    end_instret = get_instret();
+    cycles_elapsed = end_cycles - start_cycles;
+    instret_elapsed = end_instret - start_instret;
+
+    TEST_LOGGER("  Cycles: ");
+    print_dec((unsigned long) cycles_elapsed);
+    TEST_LOGGER("  Instructions: ");
+    print_dec((unsigned long) instret_elapsed);
+
+    TEST_LOGGER("\n");
+
+    /* Test 18: MLP inference */
+    TEST_LOGGER("Test 18: bf16 MLP inference\n");
+    start_cycles = get_cycles();
+    start_instret = get_instret();
+
+    test_bf16_mlp();
+
+    end_cycles = get_cycles();
+    end_instret = get_instret();
+    cycles_elapsed = end_cycles - start_cycles;
+    instret_elapsed = end_instret - start_instret;
+
+    TEST_LOGGER("  Cycles: ");
+    print_dec((unsigned long) cycles_elapsed);
+    TEST_LOGGER("  Instructions: ");
+    print_dec((unsigned long) instret_elapsed);
+
+    TEST_LOGGER("\n");
+
+    /* Test 19: reductions */
+    TEST_LOGGER("Test 19: bf16 reductions\n");
+    start_cycles = get_cycles();
+    start_instret = get_instret();
+
+    test_bf16_reduce();
+
+    end_cycles = get_cycles();
+    end_instret = get_instret();
+    cycles_elapsed = end_cycles - start_cycles;
+    instret_elapsed = end_instret - start_instret;
+
+    TEST_LOGGER("  Cycles: ");
+    print_dec((unsigned long) cycles_elapsed);
+    TEST_LOGGER("  Instructions: ");
+    print_dec((unsigned long) instret_elapsed);
+
+    TEST_LOGGER("\n");
+
+    /* Test 20: ChaCha20 streaming */
+    TEST_LOGGER("Test 20: ChaCha20 streaming\n");
+    start_cycles = get_cycles();
+    start_instret = get_instret();
+
+    test_chacha20_stream();
+
+    end_cycles = get_cycles();
+    end_instret = get_instret();
+    cycles_elapsed = end_cycles - start_cycles;
+    instret_elapsed = end_instret - start_instret;
+
+    TEST_LOGGER("  Cycles: ");
+    print_dec((unsigned long) cycles_elapsed);
+    TEST_LOGGER("  Instructions: ");
+    print_dec((unsigned long) instret_elapsed);
+
+    TEST_LOGGER("\n");
+
+    /* Test 21: ChaCha20 unaligned buffers */
+    TEST_LOGGER("Test 21: ChaCha20 unaligned buffers\n");
+    start_cycles = get_cycles();
+    start_instret = get_instret();
+
+    test_chacha20_unaligned();
+
+    end_cycles = get_cycles();
+    end_instret = get_instret();
+    cycles_elapsed = end_cycles - start_cycles;
+    instret_elapsed = end_instret - start_instret;
+
+    TEST_LOGGER("  Cycles: ");
+    print_dec((unsigned long) cycles_elapsed);
+    TEST_LOGGER("  Instructions: ");
+    print_dec((unsigned long) instret_elapsed);
+
+    TEST_LOGGER("\n");
+
+    /* Test 22: ChaCha20-Poly1305 */
+    TEST_LOGGER("Test 22: ChaCha20-Poly1305\n");
+    start_cycles = get_cycles();
+    start_instret = get_instret();
+
+    test_chacha20_poly1305();
+
+    end_cycles = get_cycles();
+    end_instret = get_instret();
+    cycles_elapsed = end_cycles - start_cycles;
+    instret_elapsed = end_instret - start_instret;
+
+    TEST_LOGGER("  Cycles: ");
+    print_dec((unsigned long) cycles_elapsed);
+    TEST_LOGGER("  Instructions: ");
+    print_dec((unsigned long) instret_elapsed);
+
+    TEST_LOGGER("\n");
+
+    /* Test 23: XChaCha20 */
+    TEST_LOGGER("Test 23: XChaCha20\n");
+    start_cycles = get_cycles();
+    start_instret = get_instret();
+
+    test_xchacha20();
+
+    end_cycles = get_cycles();
+    end_instret = get_instret();
+    cycles_elapsed = end_cycles - start_cycles;
+    instret_elapsed = end_instret - start_instret;
+
+    TEST_LOGGER("  Cycles: ");
+    print_dec((unsigned long) cycles_elapsed);
+    TEST_LOGGER("  Instructions: ");
+    print_dec((unsigned long) instret_elapsed);
+
+    TEST_LOGGER("\n");
+
+    /* Test 24: ChaCha20 CSPRNG */
+    TEST_LOGGER("Test 24: ChaCha20 CSPRNG\n");
+    start_cycles = get_cycles();
+    start_instret = get_instret();
+
+    test_csprng();
+
+    end_cycles = get_cycles();
+    end_instret = get_instret();
+    cycles_elapsed = end_cycles - start_cycles;
+    instret_elapsed = end_instret - start_instret;
+
+    TEST_LOGGER("  Cycles: ");
+    print_dec((unsigned long) cycles_elapsed);
+    TEST_LOGGER("  Instructions: ");
+    print_dec((unsigned long) instret_elapsed);
+
+    TEST_LOGGER("\n");
+
+    /* Test 25: ChaCha round counts */
+    TEST_LOGGER("Test 25: ChaCha round counts\n");
+    start_cycles = get_cycles();
+    start_instret = get_instret();
+
+    test_chacha_rounds();
+
+    end_cycles = get_cycles();
+    end_instret = get_instret();
+    cycles_elapsed = end_cycles - start_cycles;
+    instret_elapsed = end_instret - start_instret;
+
+    TEST_LOGGER("  Cycles: ");
+    print_dec((unsigned long) cycles_elapsed);
+    TEST_LOGGER("  Instructions: ");
+    print_dec((unsigned long) instret_elapsed);
+
+    TEST_LOGGER("\n");
+
+    /* Test 26: ChaCha20 scatter/gather */
+    TEST_LOGGER("Test 26: ChaCha20 scatter/gather\n");
+    start_cycles = get_cycles();
+    start_instret = get_instret();
+
+    test_chacha20_iov();
 
     end_cycles = get_cycles();
     end_instret = get_instret();
     cycles_elapsed = end_cycles - start_cycles;
     instret_elapsed = end_instret - start_instret;
 
-    /* 原本 bf16 結束後的輸出 */
     TEST_LOGGER("  Cycles: ");
     print_dec((unsigned long) cycles_elapsed);
     TEST_LOGGER("  Instructions: ");
@@ -747,6 +3511,40 @@ int main(void)
     }
     /* ===== Problem B 測試到這裡 ===== */
 
+    TEST_LOGGER("\n=== BFloat16 Benchmarks ===\n\n");
+
+    bench_init();
+    bench_bf16_array();
+    bench_bf16_mul_table();
+    bench_bf16_div_recip();
+    bench_bf16_sqrt();
+    bench_bf16_dot();
+    bench_bf16_gemm();
+    bench_bf16_asm();
+    bench_bf16x2();
+    bench_bf16_math();
+    bench_bf16_finite();
+    bench_bf16_sort();
+    bench_f32_convert();
+    bench_bf16_mlp();
+    bench_bf16_reduce();
+
+    TEST_LOGGER("\n=== ChaCha20 Benchmarks ===\n\n");
+#if CHACHA_ZBB
+    TEST_LOGGER("Rotates: Zbb rori (CHACHA_ZBB=1)\n\n");
+#else
+    TEST_LOGGER("Rotates: slli/srli/xor (CHACHA_ZBB=0)\n\n");
+#endif
+
+    bench_chacha20_stream();
+    bench_chacha20_align();
+    bench_chacha20_poly1305();
+    bench_xchacha20();
+    bench_csprng();
+    bench_chacha_rounds();
+    bench_chacha20_sweep();
+    bench_chacha20_iov();
+
     TEST_LOGGER("\n=== All Tests Completed ===\n");
 
     return 0;
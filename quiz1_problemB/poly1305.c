@@ -0,0 +1,126 @@
+#include <stddef.h>
+#include <stdint.h>
+
+#include "poly1305.h"
+
+#define LIMB_MASK 0xFFFFFF
+
+static uint32_t load32_le(const uint8_t *p)
+{
+    return p[0] | (uint32_t) p[1] << 8 | (uint32_t) p[2] << 16 |
+           (uint32_t) p[3] << 24;
+}
+
+void poly1305_init(poly1305_ctx_t *ctx, const uint8_t key[32])
+{
+    uint32_t r0 = load32_le(key) & 0x0FFFFFFF;
+    uint32_t r1 = load32_le(key + 4) & 0x0FFFFFFC;
+    uint32_t r2 = load32_le(key + 8) & 0x0FFFFFFC;
+    uint32_t r3 = load32_le(key + 12) & 0x0FFFFFFC;
+    uint32_t r[6] = {
+        r0 & LIMB_MASK,
+        (r0 >> 24 | r1 << 8) & LIMB_MASK,
+        (r1 >> 16 | r2 << 16) & LIMB_MASK,
+        r2 >> 8,
+        r3 & LIMB_MASK,
+        r3 >> 24,
+    };
+
+    /* T[k] = T[k - 1] + r; 15 r < 2^128 needs no reduction */
+    for (int i = 0; i < 8; i++)
+        ctx->table[0][i] = 0;
+    for (int k = 1; k < 16; k++) {
+        uint32_t c = 0;
+        for (int i = 0; i < 6; i++) {
+            uint32_t v = ctx->table[k - 1][i] + r[i] + c;
+            c = v >> 24;
+            ctx->table[k][i] = i < 5 ? v & LIMB_MASK : v;
+        }
+        ctx->table[k][6] = ctx->table[k][7] = 0;
+    }
+
+    for (int i = 0; i < 6; i++)
+        ctx->h[i] = 0;
+    for (int i = 0; i < 4; i++)
+        ctx->s[i] = load32_le(key + 16 + 4 * i);
+    ctx->buf_len = 0;
+}
+
+void poly1305_update(poly1305_ctx_t *ctx, const uint8_t *m, size_t len)
+{
+    /* top up a buffered partial block first */
+    if (ctx->buf_len) {
+        for (; len && ctx->buf_len < 16; len--)
+            ctx->buf[ctx->buf_len++] = *m++;
+        if (ctx->buf_len < 16)
+            return;
+        poly1305_blocks(ctx->h, ctx->table, ctx->buf, 1, 1);
+        ctx->buf_len = 0;
+    }
+
+    size_t nblocks = len >> 4;
+    if (nblocks) {
+        poly1305_blocks(ctx->h, ctx->table, m, nblocks, 1);
+        m += nblocks << 4;
+        len &= 15;
+    }
+
+    for (; len; len--)
+        ctx->buf[ctx->buf_len++] = *m++;
+}
+
+void poly1305_final(poly1305_ctx_t *ctx, uint8_t tag[16])
+{
+    uint32_t *h = ctx->h;
+
+    /* the last partial block is padded with 1 and zeros, and has no 2^128 */
+    if (ctx->buf_len) {
+        ctx->buf[ctx->buf_len] = 1;
+        for (uint32_t i = ctx->buf_len + 1; i < 16; i++)
+            ctx->buf[i] = 0;
+        poly1305_blocks(h, ctx->table, ctx->buf, 1, 0);
+    }
+
+    /* carry twice, folding the bits above 2^130: h < 2^130 */
+    for (int pass = 0; pass < 2; pass++) {
+        uint32_t c = h[5] >> 10;
+        h[5] &= 0x3FF;
+        h[0] += (c << 2) + c;
+        for (int i = 0; i < 5; i++) {
+            h[i + 1] += h[i] >> 24;
+            h[i] &= LIMB_MASK;
+        }
+    }
+
+    /* g = h + 5 - 2^130; take g when it is not negative, i.e. h >= p */
+    uint32_t g[6], c = 5;
+    for (int i = 0; i < 6; i++) {
+        g[i] = h[i] + c;
+        c = g[i] >> 24;
+        g[i] &= LIMB_MASK;
+    }
+    uint32_t use_g = -((g[5] >> 10) & 1);
+    for (int i = 0; i < 6; i++)
+        h[i] = (h[i] & ~use_g) | (g[i] & use_g);
+
+    /* tag = (h + s) mod 2^128 */
+    uint32_t w[4] = {
+        h[0] | h[1] << 24,
+        h[1] >> 8 | h[2] << 16,
+        h[2] >> 16 | h[3] << 8,
+        h[4] | h[5] << 24,
+    };
+    uint64_t sum = 0;
+    for (int i = 0; i < 4; i++) {
+        sum += (uint64_t) w[i] + ctx->s[i];
+        tag[4 * i] = sum;
+        tag[4 * i + 1] = sum >> 8;
+        tag[4 * i + 2] = sum >> 16;
+        tag[4 * i + 3] = sum >> 24;
+        sum >>= 32;
+    }
+
+    volatile uint32_t *p = (volatile uint32_t *) ctx;
+    for (size_t i = 0; i < sizeof(*ctx) / sizeof(uint32_t); i++)
+        p[i] = 0;
+}
@@ -0,0 +1,39 @@
+#ifndef POLY1305_H
+#define POLY1305_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* ============= Poly1305 (RFC 8439) =============
+ *
+ * With no multiply instruction every product would go through the shift
+ * and add loop of __mulsi3, at a few instructions per multiplier bit, and
+ * a 32 x 32 -> 64 bit product would take four of them.  So there are
+ * none: h is held in six 24-bit limbs, and h * r is a Horner scan over
+ * the nibbles of h against a table of k * r, k < 16, built once per key
+ * (see poly1305_asm.S).  A 16-byte block costs about 1450 instructions.
+ */
+typedef struct {
+    uint32_t table[16][8]; /* k * r in limbs 0..5, rows padded to 8 words */
+    uint32_t h[6];
+    uint32_t s[4];
+    uint8_t buf[16];
+    uint32_t buf_len;
+} poly1305_ctx_t;
+
+void poly1305_init(poly1305_ctx_t *ctx, const uint8_t key[32]);
+void poly1305_update(poly1305_ctx_t *ctx, const uint8_t *m, size_t len);
+
+/* Write the tag and clear the context */
+void poly1305_final(poly1305_ctx_t *ctx, uint8_t tag[16]);
+
+/* poly1305_asm.S: h = (h + block + hibit * 2^128) * r for each 16-byte
+ * block of m; m may have any alignment.
+ */
+void poly1305_blocks(uint32_t h[6],
+                     const uint32_t table[16][8],
+                     const uint8_t *m,
+                     size_t nblocks,
+                     uint32_t hibit);
+
+#endif
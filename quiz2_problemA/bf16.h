@@ -0,0 +1,316 @@
+#ifndef BF16_H
+#define BF16_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+/* ============= BFloat16 Implementation ============= */
+
+typedef struct {
+    uint16_t bits;
+} bf16_t;
+
+#define BF16_EXP_BIAS 127
+#define BF16_SIGN_MASK 0x8000U
+#define BF16_EXP_MASK 0x7F80U
+#define BF16_MANT_MASK 0x007FU
+
+#define BF16_NAN() ((bf16_t) {.bits = 0x7FC0})
+#define BF16_ZERO() ((bf16_t) {.bits = 0x0000})
+
+static const bf16_t bf16_one = {.bits = 0x3F80};
+static const bf16_t bf16_two = {.bits = 0x4000};
+
+static inline bool bf16_isnan(bf16_t a)
+{
+    return ((a.bits & BF16_EXP_MASK) == BF16_EXP_MASK) &&
+           (a.bits & BF16_MANT_MASK);
+}
+
+static inline bool bf16_isinf(bf16_t a)
+{
+    return ((a.bits & BF16_EXP_MASK) == BF16_EXP_MASK) &&
+           !(a.bits & BF16_MANT_MASK);
+}
+
+static inline bool bf16_iszero(bf16_t a)
+{
+    return !(a.bits & 0x7FFF);
+}
+
+/* Count leading zeros by binary search without branches: each step
+ * shifts x left by 16, 8, 4, 2 or 1 when that many top bits are zero.
+ */
+static inline unsigned clz(uint32_t x)
+{
+    unsigned n = 0, s;
+
+    s = !(x >> 16) << 4;
+    n += s;
+    x <<= s;
+    s = !(x >> 24) << 3;
+    n += s;
+    x <<= s;
+    s = !(x >> 28) << 2;
+    n += s;
+    x <<= s;
+    s = !(x >> 30) << 1;
+    n += s;
+    x <<= s;
+    s = !(x >> 31);
+    n += s;
+    x <<= s;
+    return n + !x;
+}
+
+/* Significand with the hidden bit, denormals normalized (*exp adjusted).
+ * a must be finite and non-zero.
+ */
+static inline uint32_t bf16_unpack_mant(bf16_t a, int32_t *exp)
+{
+    uint32_t mant = a.bits & 0x7F;
+
+    *exp = (a.bits >> 7) & 0xFF;
+    if (*exp)
+        return mant | 0x80;
+
+    uint32_t sh = clz(mant) - 24;
+    *exp = 1 - sh;
+    return mant << sh;
+}
+
+/* Round sig * 2^(exp - 157) to bf16, to nearest with ties to even.  sig
+ * has its leading one in bit 30: bits 23..30 are the 8 significant bits,
+ * bit 22 the guard bit and bits 0..21 the sticky part.  exp is the biased
+ * exponent with no range limit.  Overflow gives infinity.  Below the
+ * normal range sig is first shifted into denormal position, the bits
+ * shifted out kept as a sticky bit, so an underflow is rounded only once.
+ * A carry out of the significand runs into the exponent field, which also
+ * takes the largest denormal up to the smallest normal and the largest
+ * finite value up to infinity.
+ */
+static inline bf16_t bf16_round_pack(uint32_t sign, int32_t exp, uint32_t sig)
+{
+    uint16_t s = sign << 15;
+
+    if (exp >= 0xFF)
+        return (bf16_t) {.bits = s | 0x7F80};
+    if (exp <= 0) {
+        uint32_t sh = 1 - exp;
+        sig = sh < 32 ? (sig >> sh) | ((sig << (32 - sh)) != 0) : 1;
+        exp = 1;
+    }
+    sig += 0x3FFFFF + ((sig >> 23) & 1);
+    return (bf16_t) {.bits = s | (((exp - 1) << 7) + (sig >> 23))};
+}
+
+/* a + b for finite non-zero operands, given as sign, biased exponent and
+ * 8-bit significand; a denormal comes in as exponent 1 without the hidden
+ * bit.  One shift aligns the smaller operand and one shift by clz
+ * normalizes the sum, so the step count does not depend on the values.
+ */
+static inline bf16_t bf16_add_unpacked(uint32_t sign_a,
+                                       int32_t exp_a,
+                                       uint32_t mant_a,
+                                       uint32_t sign_b,
+                                       int32_t exp_b,
+                                       uint32_t mant_b)
+{
+    if (exp_a < exp_b) {
+        uint32_t t = sign_a;
+        sign_a = sign_b;
+        sign_b = t;
+        t = exp_a;
+        exp_a = exp_b;
+        exp_b = t;
+        t = mant_a;
+        mant_a = mant_b;
+        mant_b = t;
+    }
+
+    /* b is below half an ulp of a, even when a is a power of two and the
+     * ulp below it is half as large: a is the rounded result
+     */
+    uint32_t exp_diff = exp_a - exp_b;
+    if (exp_diff > 9)
+        return (bf16_t) {.bits = sign_a << 15 | (((exp_a - 1) << 7) + mant_a)};
+
+    /* both fit with 14 zero bits to spare, so the alignment is exact */
+    uint32_t sig_a = mant_a << 23, sig_b = (mant_b << 23) >> exp_diff;
+    uint32_t result_mant;
+
+    if (sign_a == sign_b)
+        result_mant = sig_a + sig_b;
+    else if (sig_a >= sig_b)
+        result_mant = sig_a - sig_b;
+    else {
+        result_mant = sig_b - sig_a;
+        sign_a = sign_b;
+    }
+    if (!result_mant)
+        return BF16_ZERO();
+
+    uint32_t lz = clz(result_mant);
+    return bf16_round_pack(sign_a, exp_a + 1 - lz, (result_mant << lz) >> 1);
+}
+
+static inline bf16_t bf16_add(bf16_t a, bf16_t b)
+{
+    uint16_t sign_a = a.bits >> 15 & 0x1, sign_b = b.bits >> 15 & 1;
+    int16_t exp_a = a.bits >> 7 & 0xFF, exp_b = b.bits >> 7 & 0xFF;
+    uint16_t mant_a = a.bits & 0x7F, mant_b = b.bits & 0x7F;
+
+    /* Infinity and NaN */
+    if (exp_a == 0xFF) {
+        if (mant_a)
+            return a;
+        if (exp_b == 0xFF)
+            return (mant_b || sign_a == sign_b) ? b : BF16_NAN();
+        return a;
+    }
+
+    /* if a is normal/denormal, but b is infinity/NaN */
+    if (exp_b == 0xFF)
+        return b;
+
+    /* if a == 0, b == 0; the sum of two zeros is -0 only if both are */
+    if (!exp_a && !mant_a) {
+        if (!exp_b && !mant_b)
+            return (bf16_t) {.bits = a.bits & b.bits};
+        return b;
+    }
+    if (!exp_b && !mant_b)
+        return a;
+
+    /* if a, b is normal; a denormal keeps exponent 1 */
+    if (exp_a)
+        mant_a |= 0x80;
+    else
+        exp_a = 1;
+    if (exp_b)
+        mant_b |= 0x80;
+    else
+        exp_b = 1;
+
+    return bf16_add_unpacked(sign_a, exp_a, mant_a, sign_b, exp_b, mant_b);
+}
+
+static inline bf16_t bf16_sub(bf16_t a, bf16_t b)
+{
+    b.bits ^= 0x8000U;
+    return bf16_add(a, b);
+}
+
+/* Product of two significands with the hidden bit set, denormals
+ * normalized; exp is the biased exponent of the product.
+ */
+static inline bf16_t bf16_mul_unpacked(uint32_t sign,
+                                       int32_t exp,
+                                       uint32_t mant_a,
+                                       uint32_t mant_b)
+{
+    uint32_t result_mant = mant_a * mant_b;
+
+    /* the product is in [2^14, 2^16): one shift puts the top bit at 30 */
+    uint32_t carry = result_mant >> 15;
+    return bf16_round_pack(sign, exp + carry, result_mant << (16 - carry));
+}
+
+static inline bf16_t bf16_mul(bf16_t a, bf16_t b)
+{
+    uint16_t sign_a = (a.bits >> 15) & 1;
+    uint16_t sign_b = (b.bits >> 15) & 1;
+    int32_t exp_a = ((a.bits >> 7) & 0xFF);
+    int32_t exp_b = ((b.bits >> 7) & 0xFF);
+    uint32_t mant_a = a.bits & 0x7F;
+    uint32_t mant_b = b.bits & 0x7F;
+
+    uint16_t result_sign = sign_a ^ sign_b;
+
+    if (exp_a == 0xFF && mant_a)
+        return a;
+    if (exp_b == 0xFF && mant_b)
+        return b;
+    if (exp_a == 0xFF || exp_b == 0xFF) {
+        if ((!exp_a && !mant_a) || (!exp_b && !mant_b))
+            return BF16_NAN();
+        return (bf16_t) {.bits = (result_sign << 15) | 0x7F80};
+    }
+    if ((!exp_a && !mant_a) || (!exp_b && !mant_b))
+        return (bf16_t) {.bits = result_sign << 15};
+
+    /* denormals normalized with one shift, exponents adjusted */
+    mant_a = bf16_unpack_mant(a, &exp_a);
+    mant_b = bf16_unpack_mant(b, &exp_b);
+
+    return bf16_mul_unpacked(result_sign, exp_a + exp_b - BF16_EXP_BIAS,
+                             mant_a, mant_b);
+}
+
+/* Quotient of two significands with the hidden bit set, denormals
+ * normalized; exp is the biased exponent of the quotient when
+ * mant_a >= mant_b.  Sixteen restoring steps give the quotient
+ * floor(mant_a * 2^15 / mant_b) in [2^14, 2^16), and the remainder the
+ * sticky bit; one shift then puts the top bit at 30.
+ */
+static inline bf16_t bf16_div_unpacked(uint32_t sign,
+                                       int32_t exp,
+                                       uint32_t mant_a,
+                                       uint32_t mant_b)
+{
+    uint32_t dividend = mant_a << 15;
+    uint32_t quotient = 0;
+
+    for (int i = 0; i < 16; i++) {
+        quotient <<= 1;
+        if (dividend >= (mant_b << (15 - i))) {
+            dividend -= (mant_b << (15 - i));
+            quotient |= 1;
+        }
+    }
+
+    uint32_t carry = quotient >> 15;
+    return bf16_round_pack(sign, exp - 1 + carry,
+                           quotient << (16 - carry) | (dividend != 0));
+}
+
+static inline bf16_t bf16_div(bf16_t a, bf16_t b)
+{
+    uint16_t sign_a = (a.bits >> 15) & 1;
+    uint16_t sign_b = (b.bits >> 15) & 1;
+    int32_t exp_a = ((a.bits >> 7) & 0xFF);
+    int32_t exp_b = ((b.bits >> 7) & 0xFF);
+    uint32_t mant_a = a.bits & 0x7F;
+    uint32_t mant_b = b.bits & 0x7F;
+
+    uint16_t result_sign = sign_a ^ sign_b;
+
+    if (exp_a == 0xFF && mant_a)
+        return a;
+    if (exp_b == 0xFF) {
+        if (mant_b)
+            return b;
+        /* Inf/Inf = NaN */
+        if (exp_a == 0xFF && !mant_a)
+            return BF16_NAN();
+        return (bf16_t) {.bits = result_sign << 15};
+    }
+    if (!exp_b && !mant_b) {
+        if (!exp_a && !mant_a)
+            return BF16_NAN();
+        return (bf16_t) {.bits = (result_sign << 15) | 0x7F80};
+    }
+    if (exp_a == 0xFF)
+        return (bf16_t) {.bits = (result_sign << 15) | 0x7F80};
+    if (!exp_a && !mant_a)
+        return (bf16_t) {.bits = result_sign << 15};
+
+    /* denormals normalized with one shift, exponents adjusted */
+    mant_a = bf16_unpack_mant(a, &exp_a);
+    mant_b = bf16_unpack_mant(b, &exp_b);
+
+    return bf16_div_unpacked(result_sign, exp_a - exp_b + BF16_EXP_BIAS,
+                             mant_a, mant_b);
+}
+
+#endif
@@ -0,0 +1,146 @@
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "bf16_array.h"
+
+/* ============= Normal-operand fast paths =============
+ *
+ * These are the scalar ops with every special-value branch removed.  They
+ * are only valid when both operands are normal finite numbers (biased
+ * exponent 1..254); the array kernels check that once per block and fall
+ * back to the full scalar op otherwise.
+ */
+
+/* 1 if bits is zero, denormal, Inf or NaN; computed without branches. */
+static inline uint32_t not_normal(uint16_t bits)
+{
+    return (uint16_t) ((bits & BF16_EXP_MASK) - 0x80) >= 0x7F00;
+}
+
+static inline uint32_t special4(const bf16_t *p)
+{
+    return not_normal(p[0].bits) | not_normal(p[1].bits) |
+           not_normal(p[2].bits) | not_normal(p[3].bits);
+}
+
+static inline bf16_t add_normal(bf16_t a, bf16_t b)
+{
+    return bf16_add_unpacked(a.bits >> 15, a.bits >> 7 & 0xFF,
+                             (a.bits & 0x7F) | 0x80, b.bits >> 15,
+                             b.bits >> 7 & 0xFF, (b.bits & 0x7F) | 0x80);
+}
+
+static inline bf16_t sub_normal(bf16_t a, bf16_t b)
+{
+    b.bits ^= BF16_SIGN_MASK;
+    return add_normal(a, b);
+}
+
+static inline bf16_t mul_normal(bf16_t a, bf16_t b)
+{
+    int32_t exp_a = (a.bits >> 7) & 0xFF;
+    int32_t exp_b = (b.bits >> 7) & 0xFF;
+
+    return bf16_mul_unpacked((a.bits ^ b.bits) >> 15,
+                             exp_a + exp_b - BF16_EXP_BIAS,
+                             (a.bits & 0x7F) | 0x80, (b.bits & 0x7F) | 0x80);
+}
+
+static inline bf16_t div_normal(bf16_t a, bf16_t b)
+{
+    int32_t exp_a = (a.bits >> 7) & 0xFF;
+    int32_t exp_b = (b.bits >> 7) & 0xFF;
+
+    return bf16_div_unpacked((a.bits ^ b.bits) >> 15,
+                             exp_a - exp_b + BF16_EXP_BIAS,
+                             (a.bits & 0x7F) | 0x80, (b.bits & 0x7F) | 0x80);
+}
+
+/* ============= Array kernels ============= */
+
+/* Four elements per iteration; a block containing any special operand is
+ * handed to the scalar op element by element, the tail likewise.
+ */
+#define BF16_BINARY_KERNEL(name, op, fast)                                 \
+    void name(bf16_t *dst, const bf16_t *a, const bf16_t *b, size_t n)     \
+    {                                                                      \
+        size_t i = 0;                                                      \
+                                                                           \
+        for (; i + 4 <= n; i += 4) {                                       \
+            if (special4(a + i) | special4(b + i)) {                       \
+                dst[i] = op(a[i], b[i]);                                   \
+                dst[i + 1] = op(a[i + 1], b[i + 1]);                       \
+                dst[i + 2] = op(a[i + 2], b[i + 2]);                       \
+                dst[i + 3] = op(a[i + 3], b[i + 3]);                       \
+                continue;                                                  \
+            }                                                              \
+            dst[i] = fast(a[i], b[i]);                                     \
+            dst[i + 1] = fast(a[i + 1], b[i + 1]);                         \
+            dst[i + 2] = fast(a[i + 2], b[i + 2]);                         \
+            dst[i + 3] = fast(a[i + 3], b[i + 3]);                         \
+        }                                                                  \
+        for (; i < n; i++)                                                 \
+            dst[i] = op(a[i], b[i]);                                       \
+    }
+
+BF16_BINARY_KERNEL(bf16_add_n, bf16_add, add_normal)
+BF16_BINARY_KERNEL(bf16_sub_n, bf16_sub, sub_normal)
+BF16_BINARY_KERNEL(bf16_mul_n, bf16_mul, mul_normal)
+BF16_BINARY_KERNEL(bf16_div_n, bf16_div, div_normal)
+
+/* The product may underflow to zero or a denormal, so it is re-checked
+ * before taking the fast add.
+ */
+static inline bf16_t axpy_normal(bf16_t alpha, bf16_t x, bf16_t y)
+{
+    bf16_t p = mul_normal(alpha, x);
+    if (not_normal(p.bits))
+        return bf16_add(p, y);
+    return add_normal(p, y);
+}
+
+void bf16_axpy_n(bf16_t *y, bf16_t alpha, const bf16_t *x, size_t n)
+{
+    size_t i = 0;
+
+    if (!not_normal(alpha.bits)) {
+        for (; i + 4 <= n; i += 4) {
+            if (special4(x + i) | special4(y + i)) {
+                y[i] = bf16_add(bf16_mul(alpha, x[i]), y[i]);
+                y[i + 1] = bf16_add(bf16_mul(alpha, x[i + 1]), y[i + 1]);
+                y[i + 2] = bf16_add(bf16_mul(alpha, x[i + 2]), y[i + 2]);
+                y[i + 3] = bf16_add(bf16_mul(alpha, x[i + 3]), y[i + 3]);
+                continue;
+            }
+            y[i] = axpy_normal(alpha, x[i], y[i]);
+            y[i + 1] = axpy_normal(alpha, x[i + 1], y[i + 1]);
+            y[i + 2] = axpy_normal(alpha, x[i + 2], y[i + 2]);
+            y[i + 3] = axpy_normal(alpha, x[i + 3], y[i + 3]);
+        }
+    }
+    for (; i < n; i++)
+        y[i] = bf16_add(bf16_mul(alpha, x[i]), y[i]);
+}
+
+void bf16_scale_n(bf16_t *dst, bf16_t alpha, const bf16_t *x, size_t n)
+{
+    size_t i = 0;
+
+    if (!not_normal(alpha.bits)) {
+        for (; i + 4 <= n; i += 4) {
+            if (special4(x + i)) {
+                dst[i] = bf16_mul(alpha, x[i]);
+                dst[i + 1] = bf16_mul(alpha, x[i + 1]);
+                dst[i + 2] = bf16_mul(alpha, x[i + 2]);
+                dst[i + 3] = bf16_mul(alpha, x[i + 3]);
+                continue;
+            }
+            dst[i] = mul_normal(alpha, x[i]);
+            dst[i + 1] = mul_normal(alpha, x[i + 1]);
+            dst[i + 2] = mul_normal(alpha, x[i + 2]);
+            dst[i + 3] = mul_normal(alpha, x[i + 3]);
+        }
+    }
+    for (; i < n; i++)
+        dst[i] = bf16_mul(alpha, x[i]);
+}
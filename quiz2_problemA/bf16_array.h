@@ -0,0 +1,23 @@
+#ifndef BF16_ARRAY_H
+#define BF16_ARRAY_H
+
+#include <stddef.h>
+
+#include "bf16.h"
+
+/* Element-wise kernels over contiguous bf16 buffers.
+ * The output may alias an input exactly, but must not partially overlap it.
+ * Results are bit-identical to calling the scalar op on each element.
+ */
+void bf16_add_n(bf16_t *dst, const bf16_t *a, const bf16_t *b, size_t n);
+void bf16_sub_n(bf16_t *dst, const bf16_t *a, const bf16_t *b, size_t n);
+void bf16_mul_n(bf16_t *dst, const bf16_t *a, const bf16_t *b, size_t n);
+void bf16_div_n(bf16_t *dst, const bf16_t *a, const bf16_t *b, size_t n);
+
+/* y[i] = alpha * x[i] + y[i] */
+void bf16_axpy_n(bf16_t *y, bf16_t alpha, const bf16_t *x, size_t n);
+
+/* dst[i] = alpha * x[i] */
+void bf16_scale_n(bf16_t *dst, bf16_t alpha, const bf16_t *x, size_t n);
+
+#endif
@@ -2,6 +2,9 @@
 #include <stdint.h>
 #include <string.h>
 
+#include "bf16.h"
+#include "bf16_array.h"
+
 #define printstr(ptr, length)                   \
     do {                                        \
         asm volatile(                           \
@@ -143,291 +146,25 @@ static void print_dec(unsigned long val)
     printstr(p, (buf + sizeof(buf) - p));
 }
 
-/* ============= BFloat16 Implementation ============= */
-
-typedef struct {
-    uint16_t bits;
-} bf16_t;
-
-#define BF16_EXP_BIAS 127
-#define BF16_SIGN_MASK 0x8000U
-#define BF16_EXP_MASK 0x7F80U
-#define BF16_MANT_MASK 0x007FU
-
-#define BF16_NAN() ((bf16_t) {.bits = 0x7FC0})
-#define BF16_ZERO() ((bf16_t) {.bits = 0x0000})
-
-static const bf16_t bf16_one = {.bits = 0x3F80};
-static const bf16_t bf16_two = {.bits = 0x4000};
-
-static inline bool bf16_isnan(bf16_t a)
-{
-    return ((a.bits & BF16_EXP_MASK) == BF16_EXP_MASK) &&
-           (a.bits & BF16_MANT_MASK);
-}
-
-static inline bool bf16_isinf(bf16_t a)
+/* Same as print_dec() but without the trailing newline */
+static void print_dec_raw(unsigned long val)
 {
-    return ((a.bits & BF16_EXP_MASK) == BF16_EXP_MASK) &&
-           !(a.bits & BF16_MANT_MASK);
-}
-
-static inline bool bf16_iszero(bf16_t a)
-{
-    return !(a.bits & 0x7FFF);
-}
-
-static inline unsigned clz(uint32_t x)
-{
-    int n = 32, c = 16;
-    do {
-        uint32_t y = x >> c;
-        if (y) {
-            n -= c;
-            x = y;
-        }
-        c >>= 1;
-    } while (c);
-    return n - x;
-}
-
-static inline bf16_t bf16_add(bf16_t a, bf16_t b)
-{
-    uint16_t sign_a = a.bits >> 15 & 0x1, sign_b = b.bits >> 15 & 1;
-    int16_t exp_a = a.bits >> 7 & 0xFF, exp_b = b.bits >> 7 & 0xFF;
-    uint16_t mant_a = a.bits & 0x7F, mant_b = b.bits & 0x7F;
-
-    /* Infinity and NaN */
-    if (exp_a == 0xFF) {
-        if (mant_a)
-            return a;
-        if (exp_b == 0xFF)
-            return (mant_b || sign_a == sign_b) ? b : BF16_NAN();
-        return a;
-    }
+    char buf[20];
+    char *p = buf + sizeof(buf) - 1;
 
-    /* if a is normal/denormal, but b is infinity/NaN */
-    if (exp_b == 0xFF)
-        return b;
-
-    /* if a == 0, b == 0 */
-    if (!exp_a && !mant_a)
-        return b;
-    if (!exp_b && !mant_b)
-        return a;
-
-    /* if a, b is normal */
-    if (exp_a)
-        mant_a |= 0x80;
-    if (exp_b)
-        mant_b |= 0x80;
-
-    int16_t exp_diff = exp_a - exp_b;
-    uint16_t result_sign;
-    int16_t result_exp;
-    uint32_t result_mant;
-
-    /* deal with result of exp */
-    if (exp_diff > 0) {
-        result_exp = exp_b;
-        if (exp_diff > 8)
-            return a;
-        mant_a <<= exp_diff;
-    } else if (exp_diff < 0) {
-        result_exp = exp_a;
-        if (exp_diff < -8)
-            return b;
-        mant_b <<= -exp_diff;
-    } else
-        result_exp = exp_a;
-
-    if (sign_a == sign_b) {
-        result_sign = sign_a;
-        result_mant = (uint32_t) mant_a + mant_b;
-        uint32_t lz = clz(result_mant);
-        for (unsigned i = 0; i < 32 - lz - 8; i++) {
-            result_mant >>= 1;
-            if (++result_exp >= 255)
-                return BF16_NAN();
-        }
+    if (val == 0) {
+        *p = '0';
+        p--;
     } else {
-        if (mant_a >= mant_b) {
-            result_sign = sign_a;
-            result_mant = mant_a - mant_b;
-        } else {
-            result_sign = sign_b;
-            result_mant = mant_b - mant_a;
-        }
-        if (!result_mant)
-            return BF16_ZERO();
-        if (result_mant < 0x80) {
-            while (!(result_mant & 0x80)) {
-                result_mant <<= 1;
-                if (--result_exp <= 0)
-                    return BF16_ZERO();
-            }
-        } else {
-            uint32_t lz = clz(result_mant);
-            for (unsigned i = 0; i < 32 - lz - 8; i++) {
-                result_mant >>= 1;
-                if (++result_exp >= 255)
-                    return BF16_NAN();
-            }
-        }
-    }
-    return (bf16_t) {
-        .bits =
-            result_sign << 15 | (result_exp & 0xFF) << 7 | result_mant & 0x7F,
-    };
-}
-
-static inline bf16_t bf16_sub(bf16_t a, bf16_t b)
-{
-    b.bits ^= 0x8000U;
-    return bf16_add(a, b);
-}
-
-static inline bf16_t bf16_mul(bf16_t a, bf16_t b)
-{
-    uint16_t sign_a = (a.bits >> 15) & 1;
-    uint16_t sign_b = (b.bits >> 15) & 1;
-    int16_t exp_a = ((a.bits >> 7) & 0xFF);
-    int16_t exp_b = ((b.bits >> 7) & 0xFF);
-    uint16_t mant_a = a.bits & 0x7F;
-    uint16_t mant_b = b.bits & 0x7F;
-
-    uint16_t result_sign = sign_a ^ sign_b;
-
-    if (exp_a == 0xFF) {
-        if (mant_a)
-            return a;
-        if (!exp_b && !mant_b)
-            return BF16_NAN();
-        return (bf16_t) {.bits = (result_sign << 15) | 0x7F80};
-    }
-    if (exp_b == 0xFF) {
-        if (mant_b)
-            return b;
-        if (!exp_a && !mant_a)
-            return BF16_NAN();
-        return (bf16_t) {.bits = (result_sign << 15) | 0x7F80};
-    }
-    if ((!exp_a && !mant_a) || (!exp_b && !mant_b))
-        return (bf16_t) {.bits = result_sign << 15};
-
-    int16_t exp_adjust = 0;
-    if (!exp_a) {
-        while (!(mant_a & 0x80)) {
-            mant_a <<= 1;
-            exp_adjust--;
-        }
-        exp_a = 1;
-    } else
-        mant_a |= 0x80;
-    if (!exp_b) {
-        while (!(mant_b & 0x80)) {
-            mant_b <<= 1;
-            exp_adjust--;
-        }
-        exp_b = 1;
-    } else
-        mant_b |= 0x80;
-
-    uint32_t result_mant = (uint32_t) mant_a * mant_b;
-    int32_t result_exp = (int32_t) exp_a + exp_b - BF16_EXP_BIAS + exp_adjust;
-
-    if (result_mant & 0x8000) {
-        result_mant = (result_mant >> 8) & 0x7F;
-        result_exp++;
-    } else
-        result_mant = (result_mant >> 7) & 0x7F;
-
-    if (result_exp >= 0xFF)
-        return (bf16_t) {.bits = (result_sign << 15) | 0x7F80};
-    if (result_exp <= 0) {
-        if (result_exp < -6)
-            return (bf16_t) {.bits = result_sign << 15};
-        result_mant >>= (1 - result_exp);
-        result_exp = 0;
-    }
-
-    return (bf16_t) {.bits = (result_sign << 15) | ((result_exp & 0xFF) << 7) |
-                             (result_mant & 0x7F)};
-}
-
-static inline bf16_t bf16_div(bf16_t a, bf16_t b)
-{
-    uint16_t sign_a = (a.bits >> 15) & 1;
-    uint16_t sign_b = (b.bits >> 15) & 1;
-    int16_t exp_a = ((a.bits >> 7) & 0xFF);
-    int16_t exp_b = ((b.bits >> 7) & 0xFF);
-    uint16_t mant_a = a.bits & 0x7F;
-    uint16_t mant_b = b.bits & 0x7F;
-
-    uint16_t result_sign = sign_a ^ sign_b;
-
-    if (exp_b == 0xFF) {
-        if (mant_b)
-            return b;
-        /* Inf/Inf = NaN */
-        if (exp_a == 0xFF && !mant_a)
-            return BF16_NAN();
-        return (bf16_t) {.bits = result_sign << 15};
-    }
-    if (!exp_b && !mant_b) {
-        if (!exp_a && !mant_a)
-            return BF16_NAN();
-        return (bf16_t) {.bits = (result_sign << 15) | 0x7F80};
-    }
-    if (exp_a == 0xFF) {
-        if (mant_a)
-            return a;
-        return (bf16_t) {.bits = (result_sign << 15) | 0x7F80};
-    }
-    if (!exp_a && !mant_a)
-        return (bf16_t) {.bits = result_sign << 15};
-
-    if (exp_a)
-        mant_a |= 0x80;
-    if (exp_b)
-        mant_b |= 0x80;
-
-    uint32_t dividend = (uint32_t) mant_a << 15;
-    uint32_t divisor = mant_b;
-    uint32_t quotient = 0;
-
-    for (int i = 0; i < 16; i++) {
-        quotient <<= 1;
-        if (dividend >= (divisor << (15 - i))) {
-            dividend -= (divisor << (15 - i));
-            quotient |= 1;
+        while (val > 0) {
+            *p = '0' + umod(val, 10);
+            p--;
+            val = udiv(val, 10);
         }
     }
 
-    int32_t result_exp = (int32_t) exp_a - exp_b + BF16_EXP_BIAS;
-
-    if (!exp_a)
-        result_exp--;
-    if (!exp_b)
-        result_exp++;
-
-    if (quotient & 0x8000)
-        quotient >>= 8;
-    else {
-        while (!(quotient & 0x8000) && result_exp > 1) {
-            quotient <<= 1;
-            result_exp--;
-        }
-        quotient >>= 8;
-    }
-    quotient &= 0x7F;
-
-    if (result_exp >= 0xFF)
-        return (bf16_t) {.bits = (result_sign << 15) | 0x7F80};
-    if (result_exp <= 0)
-        return (bf16_t) {.bits = result_sign << 15};
-    return (bf16_t) {.bits = (result_sign << 15) | ((result_exp & 0xFF) << 7) |
-                             (quotient & 0x7F)};
+    p++;
+    printstr(p, (buf + sizeof(buf) - p));
 }
 
 /* ============= ChaCha20 Declaration ============= */
@@ -598,6 +335,214 @@ static void test_bf16_special_cases(void)
     }
 }
 
+static void test_bf16_array(void)
+{
+    /* Mix of normals and every special class, so both the fast blocks and
+     * the scalar fallback blocks are exercised.
+     */
+    static const bf16_t a[19] = {
+        {0x3F80}, {0x4040}, {0xC0A0}, {0x3E00}, {0x4000}, {0x0000},
+        {0x7F80}, {0x3F81}, {0x0040}, {0x7FC0}, {0x8000}, {0x7F00},
+        {0x4120}, {0xBF80}, {0x0080}, {0x42C8}, {0x3DCC}, {0xFF80},
+        {0x4049},
+    };
+    static const bf16_t b[19] = {
+        {0x3F80}, {0x4000}, {0x4000}, {0xBE00}, {0x3F00}, {0x4000},
+        {0x4000}, {0x3F80}, {0x3F80}, {0x3F80}, {0x0000}, {0x7F00},
+        {0x4120}, {0x3F80}, {0x0080}, {0xC2C8}, {0x3DCC}, {0xFF80},
+        {0x0001},
+    };
+    const bf16_t alpha = {.bits = 0x3FC0}; /* 1.5 */
+    bf16_t out[19], y[19];
+    bool passed;
+    size_t i;
+
+    TEST_LOGGER("Test: bf16 array kernels\n");
+
+    bf16_add_n(out, a, b, 19);
+    passed = true;
+    for (i = 0; i < 19; i++)
+        if (out[i].bits != bf16_add(a[i], b[i]).bits)
+            passed = false;
+    if (passed) {
+        TEST_LOGGER("  bf16_add_n: PASSED\n");
+    } else {
+        TEST_LOGGER("  bf16_add_n: FAILED\n");
+    }
+
+    bf16_sub_n(out, a, b, 19);
+    passed = true;
+    for (i = 0; i < 19; i++)
+        if (out[i].bits != bf16_sub(a[i], b[i]).bits)
+            passed = false;
+    if (passed) {
+        TEST_LOGGER("  bf16_sub_n: PASSED\n");
+    } else {
+        TEST_LOGGER("  bf16_sub_n: FAILED\n");
+    }
+
+    bf16_mul_n(out, a, b, 19);
+    passed = true;
+    for (i = 0; i < 19; i++)
+        if (out[i].bits != bf16_mul(a[i], b[i]).bits)
+            passed = false;
+    if (passed) {
+        TEST_LOGGER("  bf16_mul_n: PASSED\n");
+    } else {
+        TEST_LOGGER("  bf16_mul_n: FAILED\n");
+    }
+
+    bf16_div_n(out, a, b, 19);
+    passed = true;
+    for (i = 0; i < 19; i++)
+        if (out[i].bits != bf16_div(a[i], b[i]).bits)
+            passed = false;
+    if (passed) {
+        TEST_LOGGER("  bf16_div_n: PASSED\n");
+    } else {
+        TEST_LOGGER("  bf16_div_n: FAILED\n");
+    }
+
+    memcpy(y, b, sizeof(y));
+    bf16_axpy_n(y, alpha, a, 19);
+    passed = true;
+    for (i = 0; i < 19; i++)
+        if (y[i].bits != bf16_add(bf16_mul(alpha, a[i]), b[i]).bits)
+            passed = false;
+    if (passed) {
+        TEST_LOGGER("  bf16_axpy_n: PASSED\n");
+    } else {
+        TEST_LOGGER("  bf16_axpy_n: FAILED\n");
+    }
+
+    bf16_scale_n(out, alpha, a, 19);
+    passed = true;
+    for (i = 0; i < 19; i++)
+        if (out[i].bits != bf16_mul(alpha, a[i]).bits)
+            passed = false;
+    if (passed) {
+        TEST_LOGGER("  bf16_scale_n: PASSED\n");
+    } else {
+        TEST_LOGGER("  bf16_scale_n: FAILED\n");
+    }
+}
+
+/* ============= Benchmarks ============= */
+
+#define BENCH_MAX_N 65536
+
+static bf16_t bench_a[BENCH_MAX_N];
+static bf16_t bench_b[BENCH_MAX_N];
+static bf16_t bench_y[BENCH_MAX_N];
+
+#define BENCH_TIME(cycles, instret, stmt)  \
+    do {                                   \
+        uint64_t _c0 = get_cycles();       \
+        uint64_t _i0 = get_instret();      \
+        stmt;                              \
+        cycles = get_cycles() - _c0;       \
+        instret = get_instret() - _i0;     \
+    } while (0)
+
+static uint32_t bench_seed = 0x2545F491;
+
+/* xorshift32: only shifts and xors, so it does not go through __mulsi3 */
+static uint32_t bench_rand(void)
+{
+    uint32_t x = bench_seed;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    bench_seed = x;
+    return x;
+}
+
+/* Random normal value with exponent in [112, 143] (about 2^-15 .. 2^16),
+ * so products and quotients of two of them stay normal.
+ */
+static bf16_t bench_rand_bf16(void)
+{
+    uint32_t r = bench_rand();
+    return (bf16_t) {.bits = (r & 0x807F) | ((112 + (r >> 16 & 0x1F)) << 7)};
+}
+
+/* Print "<cycles> cyc/elem (<instret> inst)" for a run over n elements */
+static void bench_print_per_elem(uint64_t cycles,
+                                 uint64_t instret,
+                                 unsigned long n)
+{
+    print_dec_raw(udiv((unsigned long) cycles, n));
+    TEST_LOGGER(" cyc/elem (");
+    print_dec_raw(udiv((unsigned long) instret, n));
+    TEST_LOGGER(" inst)");
+}
+
+static void bench_print_row(uint64_t scalar_cycles,
+                            uint64_t scalar_instret,
+                            uint64_t array_cycles,
+                            uint64_t array_instret,
+                            unsigned long n)
+{
+    TEST_LOGGER("scalar ");
+    bench_print_per_elem(scalar_cycles, scalar_instret, n);
+    TEST_LOGGER(" | array ");
+    bench_print_per_elem(array_cycles, array_instret, n);
+    TEST_LOGGER("\n");
+}
+
+static void bench_bf16_array(void)
+{
+    static const unsigned long sizes[] = {16, 64, 256, 1024, 4096, 16384, 65536};
+    const bf16_t alpha = {.bits = 0x3FC0}; /* 1.5 */
+    uint64_t sc, si, ac, ai;
+    unsigned long n, i;
+
+    TEST_LOGGER("Benchmark: bf16 array kernels vs scalar loop\n");
+
+    for (i = 0; i < BENCH_MAX_N; i++) {
+        bench_a[i] = bench_rand_bf16();
+        bench_b[i] = bench_rand_bf16();
+    }
+
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        n = sizes[s];
+        TEST_LOGGER("  n = ");
+        print_dec(n);
+
+        TEST_LOGGER("    add:   ");
+        BENCH_TIME(sc, si, for (i = 0; i < n; i++) bench_y[i] =
+                               bf16_add(bench_a[i], bench_b[i]));
+        BENCH_TIME(ac, ai, bf16_add_n(bench_y, bench_a, bench_b, n));
+        bench_print_row(sc, si, ac, ai, n);
+
+        TEST_LOGGER("    mul:   ");
+        BENCH_TIME(sc, si, for (i = 0; i < n; i++) bench_y[i] =
+                               bf16_mul(bench_a[i], bench_b[i]));
+        BENCH_TIME(ac, ai, bf16_mul_n(bench_y, bench_a, bench_b, n));
+        bench_print_row(sc, si, ac, ai, n);
+
+        TEST_LOGGER("    div:   ");
+        BENCH_TIME(sc, si, for (i = 0; i < n; i++) bench_y[i] =
+                               bf16_div(bench_a[i], bench_b[i]));
+        BENCH_TIME(ac, ai, bf16_div_n(bench_y, bench_a, bench_b, n));
+        bench_print_row(sc, si, ac, ai, n);
+
+        TEST_LOGGER("    scale: ");
+        BENCH_TIME(sc, si, for (i = 0; i < n; i++) bench_y[i] =
+                               bf16_mul(alpha, bench_a[i]));
+        BENCH_TIME(ac, ai, bf16_scale_n(bench_y, alpha, bench_a, n));
+        bench_print_row(sc, si, ac, ai, n);
+
+        TEST_LOGGER("    axpy:  ");
+        memcpy(bench_y, bench_b, n * sizeof(bf16_t));
+        BENCH_TIME(sc, si, for (i = 0; i < n; i++) bench_y[i] = bf16_add(
+                               bf16_mul(alpha, bench_a[i]), bench_y[i]));
+        memcpy(bench_y, bench_b, n * sizeof(bf16_t));
+        BENCH_TIME(ac, ai, bf16_axpy_n(bench_y, alpha, bench_a, n));
+        bench_print_row(sc, si, ac, ai, n);
+    }
+}
+
 int main(void)
 {
     uint64_t start_cycles, end_cycles, cycles_elapsed;
@@ -735,6 +680,28 @@ int main(void)
     print_dec((unsigned long) instret_elapsed);
     TEST_LOGGER("\n");
 
+    /* Test 7: Array kernels */
+    TEST_LOGGER("Test 7: bf16 array kernels\n");
+    start_cycles = get_cycles();
+    start_instret = get_instret();
+
+    test_bf16_array();
+
+    end_cycles = get_cycles();
+    end_instret = get_instret();
+    cycles_elapsed = end_cycles - start_cycles;
+    instret_elapsed = end_instret - start_instret;
+
+    TEST_LOGGER("  Cycles: ");
+    print_dec((unsigned long) cycles_elapsed);
+    TEST_LOGGER("  Instructions: ");
+    print_dec((unsigned long) instret_elapsed);
+    TEST_LOGGER("\n");
+
+    TEST_LOGGER("\n=== BFloat16 Benchmarks ===\n\n");
+
+    bench_bf16_array();
+
     TEST_LOGGER("\n=== All Tests Completed ===\n");
 
     return 0;